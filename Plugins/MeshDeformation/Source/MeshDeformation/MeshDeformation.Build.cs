@@ -32,6 +32,9 @@ public class MeshDeformation : ModuleRules
 				"GeometryCore",
 				"DynamicMesh",
 				"GeometryScriptingCore",
+				"MeshConversion",
+				"MeshDescription",
+				"StaticMeshDescription",
 				"Niagara",
 			}
 		);
@@ -0,0 +1,77 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Actor/MDF_InstancedProxyActor.cpp
+
+#include "Actor/MDF_InstancedProxyActor.h"
+#include "Subsystem/MDF_InstancedProxySubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/MDF_DeformableComponent.h"
+#include "Engine/DamageEvents.h"
+#include "Engine/World.h"
+
+AMDF_InstancedProxyActor::AMDF_InstancedProxyActor()
+{
+    PrimaryActorTick.bCanEverTick = false;
+    bReplicates = false;
+    SetCanBeDamaged(true);
+
+    RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+    RootComponent->SetMobility(EComponentMobility::Static);
+}
+
+float AMDF_InstancedProxyActor::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
+{
+    // 포인트 데미지는 맞은 인스턴스의 원래 액터가 받도록 전달 (변형은 그쪽 컴포넌트가 처리)
+    if (DamageEvent.IsOfType(FPointDamageEvent::ClassID))
+    {
+        const FPointDamageEvent& PointEvent = static_cast<const FPointDamageEvent&>(DamageEvent);
+        const UInstancedStaticMeshComponent* HitISM = Cast<UInstancedStaticMeshComponent>(PointEvent.HitInfo.GetComponent());
+
+        if (UMDF_InstancedProxySubsystem* Proxies = GetWorld() ? GetWorld()->GetSubsystem<UMDF_InstancedProxySubsystem>() : nullptr)
+        {
+            if (UMDF_DeformableComponent* Target = Proxies->FindInstanceOwner(HitISM, PointEvent.HitInfo.Item))
+            {
+                if (AActor* TargetActor = Target->GetOwner())
+                {
+                    return TargetActor->TakeDamage(DamageAmount, DamageEvent, EventInstigator, DamageCauser);
+                }
+            }
+        }
+    }
+
+    // [범위 피해] 폭발은 호스트 액터에 한 번만 들어오므로 맞은 인스턴스를 원래 액터별로 묶어 각각 한 번씩 전달
+    // (액터마다 자기 인스턴스 히트만 넘겨서 거리 감쇠가 그 벽 기준으로 계산되도록)
+    if (DamageEvent.IsOfType(FRadialDamageEvent::ClassID))
+    {
+        const FRadialDamageEvent& RadialEvent = static_cast<const FRadialDamageEvent&>(DamageEvent);
+        UMDF_InstancedProxySubsystem* Proxies = GetWorld() ? GetWorld()->GetSubsystem<UMDF_InstancedProxySubsystem>() : nullptr;
+
+        TMap<AActor*, TArray<FHitResult>> HitsByOwner;
+        if (Proxies)
+        {
+            for (const FHitResult& Hit : RadialEvent.ComponentHits)
+            {
+                const UInstancedStaticMeshComponent* HitISM = Cast<UInstancedStaticMeshComponent>(Hit.GetComponent());
+                UMDF_DeformableComponent* Target = Proxies->FindInstanceOwner(HitISM, Hit.Item);
+                AActor* TargetActor = Target ? Target->GetOwner() : nullptr;
+                if (IsValid(TargetActor))
+                {
+                    HitsByOwner.FindOrAdd(TargetActor).Add(Hit);
+                }
+            }
+        }
+
+        if (!HitsByOwner.IsEmpty())
+        {
+            float TotalDamage = 0.0f;
+            for (TPair<AActor*, TArray<FHitResult>>& Pair : HitsByOwner)
+            {
+                FRadialDamageEvent OwnerEvent = RadialEvent;
+                OwnerEvent.ComponentHits = MoveTemp(Pair.Value);
+                TotalDamage += Pair.Key->TakeDamage(DamageAmount, OwnerEvent, EventInstigator, DamageCauser);
+            }
+            return TotalDamage;
+        }
+    }
+
+    return Super::TakeDamage(DamageAmount, DamageEvent, EventInstigator, DamageCauser);
+}
@@ -0,0 +1,19 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Components/MDF_CollisionChunkComponent.cpp
+
+#include "Components/MDF_CollisionChunkComponent.h"
+
+UMDF_CollisionChunkComponent::UMDF_CollisionChunkComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+
+    // 보이지 않는 충돌 전용
+    SetVisibility(false);
+    SetHiddenInGame(true);
+    SetCastShadow(false);
+    SetCanEverAffectNavigation(false);
+
+    // 청크는 작으므로 비동기 쿠킹으로 게임 스레드를 막지 않습니다.
+    bUseAsyncCooking = true;
+    SetComplexAsSimpleCollisionEnabled(true, false);
+}
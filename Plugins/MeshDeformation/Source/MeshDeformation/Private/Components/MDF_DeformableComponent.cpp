@@ -3,6 +3,8 @@
 
 #include "Components/MDF_DeformableComponent.h"
 #include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/Controller.h"
 #include "Engine/Engine.h"
 #include "DrawDebugHelpers.h"
 #include "TimerManager.h"
@@ -10,6 +12,23 @@
 #include "Net/UnrealNetwork.h" 
 #include "Interface/MDF_GameStateInterface.h"
 #include "GameFramework/GameStateBase.h"
+#include "Deformation/MDF_DeformationKernel.h"
+#include "Deformation/MDF_DeformationProfile.h"
+#include "Deformation/MDF_DisplacementLayer.h"
+#include "Deformation/MDF_StaticMeshBaker.h"
+#include "Deformation/MDF_MeshAttributeUtils.h"
+#include "Deformation/MDF_MeshRefiner.h"
+#include "Deformation/MDF_MeshSimplifier.h"
+#include "Deformation/MDF_MeshStateHash.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "Subsystem/MDF_DeformationSubsystem.h"
+#include "Subsystem/MDF_BaseMeshCache.h"
+#include "Subsystem/MDF_InstancedProxySubsystem.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Components/MDF_CollisionChunkComponent.h"
+#include "PhysicsEngine/BodySetup.h"
 
 // 다이나믹 메시 관련 헤더
 #include "Components/DynamicMeshComponent.h"
@@ -26,6 +45,22 @@
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraSystem.h"
 
+static TAutoConsoleVariable<int32> CVarMDFFastRenderUpdate(
+    TEXT("MDF.Render.FastUpdate"),
+    1,
+    TEXT("1이면 변형 후 렌더 프록시를 다시 만들지 않고 바뀐 삼각형의 위치/법선/탄젠트 버퍼만 갱신합니다. 0이면 NotifyMeshUpdated (전체 재생성)."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarMDFServerHeadless(
+    TEXT("MDF.Server.Headless"),
+    1,
+    TEXT("1이면 데디 서버의 변형 메쉬에서 렌더 전용 속성(법선/탄젠트/UV)을 제거하고 관련 계산과 렌더 알림을 생략합니다. (위치/충돌만 유지)"),
+    ECVF_Default);
+
+/** 변형 배치는 버텍스 위치와 법선/탄젠트만 바꿉니다. (토폴로지/UV 불변) */
+static const EDynamicMeshAttributeChangeFlags DeformationChangeFlags =
+    EDynamicMeshAttributeChangeFlags::VertexPositions | EDynamicMeshAttributeChangeFlags::NormalsTangents;
+
 UMDF_DeformableComponent::UMDF_DeformableComponent()
 {
     // 최적화를 위해 Tick은 끕니다. (이벤트 기반 작동)
@@ -42,15 +77,15 @@ void UMDF_DeformableComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProper
     // [Step 8] 히스토리 배열 동기화 등록
     // 서버의 HitHistory가 변경되면 클라이언트에게 자동으로 전송됩니다.
     DOREPLIFETIME(UMDF_DeformableComponent, HitHistory);
+
+    // [결정론] 서버 메쉬 상태 해시 (결정론 모드가 아니면 바뀌지 않으므로 전송 비용 없음)
+    DOREPLIFETIME(UMDF_DeformableComponent, AuthoritativeMeshState);
 }
 
 void UMDF_DeformableComponent::BeginPlay()
 {
     Super::BeginPlay();
     
-    // 1. 다이나믹 메쉬 초기화 (스태틱 메쉬 복사)
-    InitializeDynamicMesh();
-    
     LastAppliedIndex = 0;
     AActor* Owner = GetOwner();
 
@@ -83,6 +118,18 @@ void UMDF_DeformableComponent::BeginPlay()
         }
     }
 
+    // 1. 다이나믹 메쉬 초기화 (스태틱 메쉬 복사)
+    // [최적화] 피해 전 스태틱 메쉬 모드면 첫 변형까지 변환 자체를 미룹니다.
+    // (저장된 히스토리를 먼저 불러와야 이미 부서진 벽이 프록시로 들어갔다가 바로 승격되지 않음)
+    if (ShouldStartAsStaticProxy())
+    {
+        EnterStaticProxy(GetTargetMeshComponent());
+    }
+    else
+    {
+        InitializeDynamicMesh();
+    }
+
     // 2. 이벤트 바인딩 및 네트워크 설정 보정
     if (IsValid(Owner))
     {
@@ -96,6 +143,8 @@ void UMDF_DeformableComponent::BeginPlay()
        // 데미지 이벤트 연결
        Owner->OnTakePointDamage.RemoveDynamic(this, &UMDF_DeformableComponent::HandlePointDamage);
        Owner->OnTakePointDamage.AddDynamic(this, &UMDF_DeformableComponent::HandlePointDamage);
+       Owner->OnTakeRadialDamage.RemoveDynamic(this, &UMDF_DeformableComponent::HandleRadialDamage);
+       Owner->OnTakeRadialDamage.AddDynamic(this, &UMDF_DeformableComponent::HandleRadialDamage);
     }
     
     // 3. 불러온 데이터가 있다면 즉시 적용 (모양 복구)
@@ -105,6 +154,21 @@ void UMDF_DeformableComponent::BeginPlay()
     }
 }
 
+void UMDF_DeformableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // [비동기] 작업이 프론트 메쉬를 읽는 중에 메쉬가 사라지지 않도록 대기
+    CancelPendingDeformation();
+
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(FreezeTimerHandle);
+        World->GetTimerManager().ClearTimer(CollisionTakeoverTimerHandle);
+    }
+    RemoveStaticProxy();
+
+    Super::EndPlay(EndPlayReason);
+}
+
 // -----------------------------------------------------------------------------
 // [Step 5] 데미지 처리 및 Gatekeeper 로직
 // -----------------------------------------------------------------------------
@@ -116,35 +180,11 @@ void UMDF_DeformableComponent::HandlePointDamage(AActor* DamagedActor, float Dam
     // 2. 기능 활성화 여부 및 유효 데미지 체크
     if (!bIsDeformationEnabled || Damage <= 0.0f) return;
 
-    // 3. 공격자 식별
-    AActor* Attacker = DamageCauser;
-    if (InstigatedBy && InstigatedBy->GetPawn())
-    {
-        Attacker = InstigatedBy->GetPawn();
-    }
-
-    // -------------------------------------------------------------------------
-    // [보안 Check] 태그 검사 로직 (Gatekeeper)
-    // -------------------------------------------------------------------------
-    if (IsValid(Attacker))
-    {
-        // (1) 자해 방지: 내가 쏜 총에 내가 찌그러지면 안 됨
-        if (Attacker == GetOwner()) return;
-
-        // (2) 권한 검사: 특정 태그(Enemy, MDF_Test)가 있는 대상만 찌그러뜨릴 수 있음
-        bool bIsEnemy = Attacker->ActorHasTag(TEXT("Enemy"));
-        bool bIsTester = Attacker->ActorHasTag(TEXT("MDF_Test"));
-
-        // 자격이 없으면 무시 (변형 거부)
-        if (!bIsEnemy && !bIsTester) return; 
-    }
+    // 3. 공격자 식별 + 태그 검사 (Gatekeeper)
+    if (!IsAttackerAllowed(InstigatedBy, DamageCauser)) return;
 
-    // 4. 컴포넌트 찾기
-    UDynamicMeshComponent* MeshComp = Cast<UDynamicMeshComponent>(FHitComponent);
-    if (!IsValid(MeshComp))
-    {
-        MeshComp = GetOwner()->FindComponentByClass<UDynamicMeshComponent>();
-    }
+    // 4. 컴포넌트 찾기 (충돌 청크에 맞았어도 변형 대상은 원본 메쉬)
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
 
     if (IsValid(MeshComp))
     {
@@ -161,13 +201,133 @@ void UMDF_DeformableComponent::HandlePointDamage(AActor* DamagedActor, float Dam
             DrawDebugPoint(GetWorld(), HitLocation, 10.0f, FColor::Red, false, 3.0f);
         }
 
-        // 7. 배칭 타이머 시작 (아직 안 돌고 있다면)
-        if (!BatchTimerHandle.IsValid())
+        // 7. 배칭 예약 (월드 스케줄러가 프레임당 한 번 플러시)
+        StartBatchTimer();
+    }
+}
+
+// -----------------------------------------------------------------------------
+// [범위 피해] 폭발 데미지 수신
+// -----------------------------------------------------------------------------
+void UMDF_DeformableComponent::HandleRadialDamage(AActor* DamagedActor, float Damage, const UDamageType* DamageType, FVector Origin, const FHitResult& HitInfo, AController* InstigatedBy, AActor* DamageCauser)
+{
+    if (!IsValid(GetOwner()) || !GetOwner()->HasAuthority()) return;
+    if (!bIsDeformationEnabled || Damage <= 0.0f) return;
+    if (!IsAttackerAllowed(InstigatedBy, DamageCauser)) return;
+
+    // 델리게이트는 폭발 반경을 넘겨주지 않으므로 컴포넌트 설정값을 사용
+    ApplyRadialDeformation(Origin, Damage, RadialInnerRadius, RadialOuterRadius, DamageType ? DamageType->GetClass() : nullptr);
+}
+
+void UMDF_DeformableComponent::ApplyRadialDeformation(FVector WorldOrigin, float Damage, float InnerRadius, float OuterRadius, TSubclassOf<UDamageType> DamageTypeClass)
+{
+    if (!IsValid(GetOwner()) || !GetOwner()->HasAuthority()) return;
+    if (!bIsDeformationEnabled || Damage <= 0.0f || OuterRadius <= 0.0f) return;
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp)) return;
+
+    // 반경은 월드 단위 → 메쉬 로컬 단위 (비균등 스케일은 가장 큰 축 기준으로 보수적으로)
+    const double Scale = FMath::Max(MeshComp->GetComponentScale().GetAbsMax(), UE_KINDA_SMALL_NUMBER);
+    const float LocalOuter = (float)(OuterRadius / Scale);
+    const float LocalInner = FMath::Clamp((float)(InnerRadius / Scale), 0.0f, LocalOuter);
+
+    // 방향은 커널이 버텍스마다 계산하므로 여기서는 이펙트/중심 겹침용으로 메쉬 중심 쪽을 기록
+    const FVector WorldDirection = (MeshComp->Bounds.Origin - WorldOrigin).GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+
+    FMDFHitData& Hit = HitQueue.Add_GetRef(FMDFHitData(ConvertWorldToLocal(WorldOrigin), ConvertWorldDirectionToLocal(WorldDirection), Damage, DamageTypeClass));
+    Hit.OuterRadius = LocalOuter;
+    Hit.InnerRadius = LocalInner;
+
+    if (bShowDebugPoints)
+    {
+        DrawDebugSphere(GetWorld(), WorldOrigin, OuterRadius, 16, FColor::Orange, false, 3.0f);
+    }
+
+    StartBatchTimer();
+}
+
+// -----------------------------------------------------------------------------
+// [최적화] 히트 일괄 제출
+// -----------------------------------------------------------------------------
+int32 UMDF_DeformableComponent::SubmitHits(TConstArrayView<FMDFHitData> WorldHits, AController* InstigatedBy, AActor* DamageCauser)
+{
+    if (!IsValid(GetOwner()) || !GetOwner()->HasAuthority()) return 0;
+    if (!bIsDeformationEnabled || WorldHits.IsEmpty()) return 0;
+
+    // 공격자 검사와 메쉬/트랜스폼 조회는 볼리당 한 번
+    if (!IsAttackerAllowed(InstigatedBy, DamageCauser)) return 0;
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp)) return 0;
+
+    const FTransform& ComponentTransform = MeshComp->GetComponentTransform();
+    const double InvScale = 1.0 / FMath::Max(ComponentTransform.GetScale3D().GetAbsMax(), UE_KINDA_SMALL_NUMBER);
+
+    const int32 NumBefore = HitQueue.Num();
+    HitQueue.Reserve(NumBefore + WorldHits.Num());
+    for (const FMDFHitData& WorldHit : WorldHits)
+    {
+        if (WorldHit.Damage <= 0.0f || WorldHit.LocalLocation.ContainsNaN() || WorldHit.LocalDirection.ContainsNaN()) continue;
+
+        FMDFHitData& Hit = HitQueue.Add_GetRef(FMDFHitData(
+            ComponentTransform.InverseTransformPosition(WorldHit.LocalLocation),
+            ComponentTransform.InverseTransformVector(WorldHit.LocalDirection),
+            WorldHit.Damage,
+            WorldHit.DamageTypeClass));
+
+        if (WorldHit.IsRadial())
+        {
+            Hit.OuterRadius = (float)(WorldHit.OuterRadius * InvScale);
+            Hit.InnerRadius = FMath::Clamp((float)(WorldHit.InnerRadius * InvScale), 0.0f, Hit.OuterRadius);
+        }
+
+        if (bShowDebugPoints)
         {
-            float Delay = FMath::Max(0.001f, BatchProcessDelay);
-            GetWorld()->GetTimerManager().SetTimer(BatchTimerHandle, this, &UMDF_DeformableComponent::ProcessDeformationBatch, Delay, false);
+            DrawDebugPoint(GetWorld(), WorldHit.LocalLocation, 10.0f, FColor::Red, false, 3.0f);
         }
     }
+
+    const int32 NumAdded = HitQueue.Num() - NumBefore;
+    if (NumAdded > 0)
+    {
+        StartBatchTimer();
+    }
+    return NumAdded;
+}
+
+int32 UMDF_DeformableComponent::K2_SubmitHits(const TArray<FVector>& WorldLocations, const TArray<FVector>& WorldDirections, FVector ShotDirection, float DamagePerHit, TSubclassOf<UDamageType> DamageTypeClass, AActor* DamageCauser)
+{
+    TArray<FMDFHitData> WorldHits;
+    WorldHits.Reserve(WorldLocations.Num());
+    for (int32 Index = 0; Index < WorldLocations.Num(); ++Index)
+    {
+        const FVector& Direction = WorldDirections.IsValidIndex(Index) ? WorldDirections[Index] : ShotDirection;
+        WorldHits.Add(FMDFHitData(WorldLocations[Index], Direction, DamagePerHit, DamageTypeClass));
+    }
+
+    APawn* InstigatorPawn = DamageCauser ? DamageCauser->GetInstigator() : nullptr;
+    return SubmitHits(WorldHits, InstigatorPawn ? InstigatorPawn->GetController() : nullptr, DamageCauser);
+}
+
+// -----------------------------------------------------------------------------
+// [보안 Check] 태그 검사 로직 (Gatekeeper)
+// -----------------------------------------------------------------------------
+bool UMDF_DeformableComponent::IsAttackerAllowed(AController* InstigatedBy, AActor* DamageCauser) const
+{
+    AActor* Attacker = DamageCauser;
+    if (InstigatedBy && InstigatedBy->GetPawn())
+    {
+        Attacker = InstigatedBy->GetPawn();
+    }
+
+    if (!IsValid(Attacker)) return true;
+
+    // (1) 자해 방지: 내가 쏜 총에 내가 찌그러지면 안 됨
+    if (Attacker == GetOwner()) return false;
+
+    // (2) 권한 검사: 특정 태그(Enemy, MDF_Test)가 있는 대상만 찌그러뜨릴 수 있음
+    return Attacker->ActorHasTag(TEXT("Enemy")) || Attacker->ActorHasTag(TEXT("MDF_Test"));
 }
 
 // -----------------------------------------------------------------------------
@@ -180,8 +340,30 @@ void UMDF_DeformableComponent::ProcessDeformationBatch()
     if (!IsValid(GetOwner()) || !GetOwner()->HasAuthority()) return;
     if (HitQueue.IsEmpty()) return;
 
+    // [최적화] 가까이 붙은 히트는 하나로 합쳐서 기록 (커널 연산/리플리케이션/저장 크기 감소)
+    // 이펙트는 원래 히트마다 재생되도록 원본 큐를 그대로 보냅니다.
+    TArray<FMDFHitData> MergedHits = HitQueue;
+    if (bCoalesceHits && MergedHits.Num() > 1)
+    {
+        const int32 NumBefore = MergedHits.Num();
+        CoalesceHits(MergedHits, (double)DeformRadius * FMath::Max(0.0f, HitCoalesceRatio));
+        UE_LOG(LogTemp, Log, TEXT("[MDF Batch] 히트 병합: %d -> %d"), NumBefore, MergedHits.Num());
+    }
+
+    // [결정론] 히트를 격자에 맞춰 기록 (전송 정밀도와 무관하게 서버/클라이언트 커널 입력이 같도록)
+    if (bDeterministicDeformation)
+    {
+        for (FMDFHitData& Hit : MergedHits)
+        {
+            Hit.LocalLocation = FMDFFixedPoint::SnapPosition(Hit.LocalLocation);
+            Hit.LocalDirection = FMDFFixedPoint::SnapDirection(Hit.LocalDirection);
+            Hit.OuterRadius = (float)FMDFFixedPoint::Dequantize(FMDFFixedPoint::Quantize(Hit.OuterRadius));
+            Hit.InnerRadius = (float)FMDFFixedPoint::Dequantize(FMDFFixedPoint::Quantize(Hit.InnerRadius));
+        }
+    }
+
     // 1. 큐에 있던 데이터를 실제 히스토리(Replicated 변수)에 병합
-    HitHistory.Append(HitQueue);
+    HitHistory.Append(MergedHits);
 
     // 2. GameState에 데이터 백업 (영속성 보장)
     if (ComponentGuid.IsValid())
@@ -198,20 +380,122 @@ void UMDF_DeformableComponent::ProcessDeformationBatch()
     NetMulticast_PlayEffects(HitQueue);
     
     // 4. 서버도 자기 자신의 모양을 바꿔야 하므로 호출
+    // (스케줄러가 있으면 같은 틱의 적용 단계에서 우선순위/예산에 따라 처리됨)
     OnRep_HitHistory(); 
 
     // 5. 큐 비우기
     HitQueue.Empty();
 }
 
+// -----------------------------------------------------------------------------
+// [최적화] 히트 공간 병합
+// -----------------------------------------------------------------------------
+void UMDF_DeformableComponent::CoalesceHits(TArray<FMDFHitData>& InOutHits, double MergeDistance)
+{
+    if (MergeDistance <= UE_KINDA_SMALL_NUMBER || InOutHits.Num() < 2) return;
+
+    // 병합 중인 클러스터 (데미지 가중 합)
+    struct FCluster
+    {
+        FVector WeightedLocation = FVector::ZeroVector;
+        FVector WeightedDirection = FVector::ZeroVector;
+        double TotalDamage = 0.0;
+        TSubclassOf<UDamageType> DamageTypeClass;
+
+        FVector GetCenter() const { return WeightedLocation / TotalDamage; }
+    };
+
+    const double MergeDistanceSq = MergeDistance * MergeDistance;
+    const double InvCellSize = 1.0 / MergeDistance;
+    auto ToCell = [InvCellSize](const FVector& Location)
+    {
+        return FIntVector(
+            FMath::FloorToInt32(Location.X * InvCellSize),
+            FMath::FloorToInt32(Location.Y * InvCellSize),
+            FMath::FloorToInt32(Location.Z * InvCellSize));
+    };
+
+    TArray<FCluster> Clusters;
+    TMultiMap<FIntVector, int32> CellClusters;
+
+    // [범위 피해] 폭발 히트는 이미 하나로 묶인 기록이므로 병합하지 않고 그대로 유지
+    TArray<FMDFHitData> RadialHits;
+
+    for (const FMDFHitData& Hit : InOutHits)
+    {
+        if (Hit.IsRadial())
+        {
+            RadialHits.Add(Hit);
+            continue;
+        }
+
+        const double Damage = FMath::Max((double)Hit.Damage, UE_KINDA_SMALL_NUMBER);
+        const FIntVector Cell = ToCell(Hit.LocalLocation);
+
+        // 주변 27칸에서 같은 데미지 타입(= 같은 강도 가중치)이고 충분히 가까운 클러스터를 찾음
+        int32 Found = INDEX_NONE;
+        for (int32 X = -1; X <= 1 && Found == INDEX_NONE; ++X)
+        {
+            for (int32 Y = -1; Y <= 1 && Found == INDEX_NONE; ++Y)
+            {
+                for (int32 Z = -1; Z <= 1 && Found == INDEX_NONE; ++Z)
+                {
+                    for (auto It = CellClusters.CreateConstKeyIterator(Cell + FIntVector(X, Y, Z)); It; ++It)
+                    {
+                        const FCluster& Candidate = Clusters[It.Value()];
+                        if (Candidate.DamageTypeClass == Hit.DamageTypeClass
+                            && FVector::DistSquared(Candidate.GetCenter(), Hit.LocalLocation) <= MergeDistanceSq)
+                        {
+                            Found = It.Value();
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (Found == INDEX_NONE)
+        {
+            Found = Clusters.AddDefaulted();
+            Clusters[Found].DamageTypeClass = Hit.DamageTypeClass;
+            CellClusters.Add(Cell, Found);
+        }
+
+        // 강도는 데미지에 선형이므로 데미지는 합산, 위치/방향은 데미지 가중 평균
+        FCluster& Cluster = Clusters[Found];
+        Cluster.WeightedLocation += Hit.LocalLocation * Damage;
+        Cluster.WeightedDirection += Hit.LocalDirection * Damage;
+        Cluster.TotalDamage += Damage;
+    }
+
+    if (Clusters.Num() + RadialHits.Num() == InOutHits.Num()) return;
+
+    InOutHits.Reset(Clusters.Num() + RadialHits.Num());
+    for (const FCluster& Cluster : Clusters)
+    {
+        const FVector Direction = Cluster.WeightedDirection.GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+        InOutHits.Add(FMDFHitData(Cluster.GetCenter(), Direction, (float)Cluster.TotalDamage, Cluster.DamageTypeClass));
+    }
+    InOutHits.Append(RadialHits);
+}
+
 // -----------------------------------------------------------------------------
 // [자식 클래스용] 배칭 타이머 시작 헬퍼
 // -----------------------------------------------------------------------------
 void UMDF_DeformableComponent::StartBatchTimer()
 {
+    const float Delay = FMath::Max(0.001f, BatchProcessDelay);
+
+    // [최적화] 컴포넌트별 타이머 대신 월드 스케줄러에 등록
+    if (UMDF_DeformationSubsystem* Scheduler = UMDF_DeformationSubsystem::Get(this))
+    {
+        Scheduler->RegisterPendingBatch(this, Delay);
+        return;
+    }
+
+    // 스케줄러가 없는 월드(에디터 프리뷰 등)에서는 기존 타이머로 처리
     if (!BatchTimerHandle.IsValid())
     {
-        float Delay = FMath::Max(0.001f, BatchProcessDelay);
         GetWorld()->GetTimerManager().SetTimer(
             BatchTimerHandle, 
             this, 
@@ -230,7 +514,7 @@ void UMDF_DeformableComponent::OnRep_HitHistory()
     AActor* Owner = GetOwner();
     if (!IsValid(Owner)) return;
 
-    UDynamicMeshComponent* MeshComp = Owner->FindComponentByClass<UDynamicMeshComponent>();
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
     if (!IsValid(MeshComp) || !IsValid(MeshComp->GetDynamicMesh())) return;
 
     int32 CurrentNum = HitHistory.Num();
@@ -240,25 +524,136 @@ void UMDF_DeformableComponent::OnRep_HitHistory()
     {
         UE_LOG(LogTemp, Warning, TEXT("[MDF] [Sync] 수리 명령(Reset) 감지!"));
         LastAppliedIndex = 0;
-        InitializeDynamicMesh(); // 메쉬 원상복구
+
+        // [최적화] 기준 자세에서 변위만 되돌림 (에셋 재임포트/법선 재계산 없음, 진행 중인 작업은 폐기됨)
+        if (!RestoreRestPose())
+        {
+            InitializeDynamicMesh();
+        }
+
+        // 수리 뒤에 이미 새 히트가 쌓여 있으면 기준 자세 위에 다시 적용
+        if (CurrentNum > 0)
+        {
+            ScheduleDeformation();
+        }
         return;
     }
 
     // 2. 변경사항 없으면 스킵
     if (LastAppliedIndex == CurrentNum) return; 
 
+    // 3. 실제 적용은 스케줄러에 맡깁니다.
+    ScheduleDeformation();
+}
+
+// -----------------------------------------------------------------------------
+// [최적화] 월드 스케줄러 연동
+// -----------------------------------------------------------------------------
+void UMDF_DeformableComponent::ScheduleDeformation()
+{
+    if (UMDF_DeformationSubsystem* Scheduler = UMDF_DeformationSubsystem::Get(this))
+    {
+        Scheduler->RequestDeformation(this);
+        return;
+    }
+
+    // 스케줄러가 없으면 즉시 적용 (슬라이스는 자체 예산 사용)
+    ApplyPendingHits(FMath::Max(0.1f, TimeSliceBudgetMs) * 0.001);
+}
+
+bool UMDF_DeformableComponent::IsDeformationRelevant(TConstArrayView<FVector> ViewerLocations) const
+{
+    if (!bDeferWhenNotRelevant || ViewerLocations.IsEmpty()) return true;
+
+    // 진행 중인 배치는 끝까지 (보류는 새 배치를 시작할지만 결정)
+    if (IsDeformationInProgress()) return true;
+
+    // 서버 권한 메쉬의 충돌은 게임플레이 기준 → 충돌을 따로 들고 있는 프록시가 있을 때만 보류
+    if (GetOwnerRole() == ROLE_Authority && !IsValid(CollisionProxyComponent)) return true;
+
+    const UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp)) return true;
+
+    // 대리 표시 중이면 실제로 그려지는 쪽으로 판정 (인스턴스는 묶음 단위라 거리로만 판정)
+    const UPrimitiveComponent* VisibleComp = bUsingStaticProxy ? static_cast<const UPrimitiveComponent*>(StaticProxyComponent.Get()) : MeshComp;
+    if (IsValid(VisibleComp) && VisibleComp->WasRecentlyRendered(RecentlyRenderedTolerance)) return true;
+
+    const FBoxSphereBounds Bounds = GetDeformationWorldBounds();
+    const double RelevantDistance = (double)DeferDistance + Bounds.SphereRadius;
+    for (const FVector& Viewer : ViewerLocations)
+    {
+        if (FVector::DistSquared(Viewer, Bounds.Origin) <= FMath::Square(RelevantDistance)) return true;
+    }
+    return false;
+}
+
+FBoxSphereBounds UMDF_DeformableComponent::GetDeformationWorldBounds() const
+{
+    const UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp)) return FBoxSphereBounds(ForceInit);
+
+    // 다이나믹 메쉬를 비워 둔 상태(대리 표시/고정/초기화 전)면 바운드가 없거나 이전 값이므로 원본 메쉬 바운드 사용
+    if ((bUsingStaticProxy || MeshComp->Bounds.SphereRadius <= UE_KINDA_SMALL_NUMBER) && IsValid(SourceStaticMesh))
+    {
+        return SourceStaticMesh->GetBounds().TransformBy(MeshComp->GetComponentTransform());
+    }
+    return MeshComp->Bounds;
+}
+
+void UMDF_DeformableComponent::UpdateDeferredDeformation()
+{
+    if (!bDeformationDeferred)
+    {
+        UE_LOG(LogTemp, Log, TEXT("[MDF Deform] 변형 보류 (%s): 보이지 않고 멀리 있음"), *GetNameSafe(GetOwner()));
+        bDeformationDeferred = true;
+    }
+
+    if (IsValid(CollisionProxyComponent))
+    {
+        DeformCollisionProxy(HitHistory.Num());
+    }
+}
+
+bool UMDF_DeformableComponent::HasPendingDeformationWork() const
+{
+    // 비동기 작업(변형/단순화) 중에는 스케줄러가 할 일이 없음 (완료 콜백이 다시 요청함)
+    if (IsAsyncDeformationInFlight() || IsSimplificationInFlight()) return false;
+
+    return IsSlicedDeformationInProgress() || LastAppliedIndex < HitHistory.Num();
+}
+
+void UMDF_DeformableComponent::ExecuteScheduledDeformation(double BudgetSeconds)
+{
+    // 컴포넌트 자체 예산과 스케줄러가 남겨준 예산 중 작은 쪽 (최소 한 조각은 항상 처리됨)
+    const double SliceBudget = FMath::Min(BudgetSeconds, FMath::Max(0.1f, TimeSliceBudgetMs) * 0.001);
+
+    if (IsSlicedDeformationInProgress())
+    {
+        StepSlicedDeformation(SliceBudget, true);
+        return;
+    }
+
+    ApplyPendingHits(SliceBudget);
+}
+
+void UMDF_DeformableComponent::ApplyPendingHits(double SliceBudgetSeconds)
+{
+    AActor* Owner = GetOwner();
+    if (!IsValid(Owner)) return;
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp) || !IsValid(MeshComp->GetDynamicMesh())) return;
+
+    const int32 CurrentNum = HitHistory.Num();
+    if (LastAppliedIndex >= CurrentNum) return;
+
+    // [비동기/타임 슬라이싱] 이미 작업이 돌고 있으면 새 히트는 다음 작업으로 넘깁니다. (완료 시 이어서 실행 → 순서 보장)
+    if (IsDeformationInProgress()) return;
+
     UE_LOG(LogTemp, Warning, TEXT("[MDF Deform] ========== 변형 시작 =========="));
     UE_LOG(LogTemp, Warning, TEXT("[MDF Deform] LastAppliedIndex: %d, CurrentNum: %d"), LastAppliedIndex, CurrentNum);
     UE_LOG(LogTemp, Warning, TEXT("[MDF Deform] DeformRadius: %.1f, DeformStrength: %.1f"), DeformRadius, DeformStrength);
 
-    // 3. 변형 계산 준비
-    const double RadiusSq = FMath::Square((double)DeformRadius);
-    const double InverseRadius = 1.0 / (double)DeformRadius;
-    
-    double MinDebugDistSq = DBL_MAX;
-    bool bAnyModified = false;
-    int32 ModifiedVertexCount = 0;
-
     // [디버그] 적용할 지점 표시
     for (int32 i = LastAppliedIndex; i < CurrentNum; ++i)
     {
@@ -272,171 +667,1705 @@ void UMDF_DeformableComponent::OnRep_HitHistory()
         }
     }
 
-    // 4. 메쉬 편집 시작 (Vertex 순회)
+    // 3. 변형 계산 준비
+    // [최적화] 첫 변형이면 여기서 다이나믹 메쉬로 전환하고 개별 상태(공간 해시/충돌 청크)를 만듭니다.
+    EnsureDynamicMesh();
+    MaterializeDeformationState(MeshComp);
+
+    // [최적화] 히트별 강도(데미지 타입 가중치 포함)는 버텍스 루프 밖에서 한 번만 계산
+    TSharedPtr<FMDFDeformBatch> Batch = MakeShared<FMDFDeformBatch>();
+    Batch->Radius = (double)DeformRadius;
+    Batch->Falloff = DeformationProfile ? DeformationProfile->MakeFalloffParams() : FMDFFalloffParams();
+    Batch->bDeterministic = bDeterministicDeformation;
+    BuildKernelHits(LastAppliedIndex, CurrentNum, Batch->Hits);
+
+    if (bDeformationDeferred)
+    {
+        UE_LOG(LogTemp, Log, TEXT("[MDF Deform] 보류 해제: 쌓인 히트 %d개를 한 배치로 적용"), Batch->Hits.Num());
+        bDeformationDeferred = false;
+    }
+
+    // 충돌 프록시는 렌더 배치를 기다리지 않고 바로 갱신
+    if (IsValid(CollisionProxyComponent))
+    {
+        DeformCollisionProxy(CurrentNum);
+    }
+
+    // [최적화] 저폴리 메쉬는 타격 반경 안만 잘게 나눈 뒤 변형 (새 버텍스도 아래 후보 수집에 포함됨)
+    if (RefineTargetEdgeLength > 0.0f)
+    {
+        RefineAroundHits(MeshComp, *Batch);
+    }
+
+    // [최적화] 새 타격 지점 반경에 걸치는 셀의 버텍스만 후보로 모읍니다.
+    // (셀 단위로 중복을 막으므로 후보 버텍스는 유일함)
+    // [범위 피해] 폭발 히트는 자기 바깥 반경으로 수집
+    // [결정론] 도달 거리 경계의 격자 반올림만큼 여유
+    const double GatherPadding = Batch->bDeterministic ? FMDFDeformationKernel::GetDeterministicGatherPadding() : 0.0;
+
     int32 TotalVertexCount = 0;
-    MeshComp->GetDynamicMesh()->EditMesh([&](UE::Geometry::FDynamicMesh3& EditMesh) 
+    MeshComp->GetDynamicMesh()->ProcessMesh([&](const UE::Geometry::FDynamicMesh3& ReadMesh)
     {
-        for (int32 VertexID : EditMesh.VertexIndicesItr())
+        TotalVertexCount = ReadMesh.VertexCount();
+        EnsureVertexHash(ReadMesh);
+
+        TSet<FIntVector> VisitedCells;
+        for (const FMDFKernelHit& Hit : Batch->Hits)
         {
-            TotalVertexCount++;
-            FVector3d VertexPos = EditMesh.GetVertex(VertexID);
-            FVector3d TotalOffset(0.0, 0.0, 0.0);
-            bool bModified = false;
+            VertexHash.GatherCandidates(Hit.Location, Hit.GetReach(Batch->Radius) + GatherPadding, VisitedCells, Batch->Candidates);
+        }
+    });
 
-            // 새로 추가된 히트 데이터들만 순회하며 오프셋 누적
-            for (int32 i = LastAppliedIndex; i < CurrentNum; ++i)
-            {
-                const FMDFHitData& Hit = HitHistory[i];
+    // 인덱스 업데이트 (다음엔 여기부터 처리)
+    LastAppliedIndex = CurrentNum;
 
-                double DistSq = FVector3d::DistSquared(VertexPos, (FVector3d)Hit.LocalLocation);
-                
-                if (DistSq < MinDebugDistSq) MinDebugDistSq = DistSq;
+    // [비동기] 버텍스/법선/탄젠트 연산을 백그라운드 작업용 메쉬에서 수행
+    if (bUseAsyncDeformation)
+    {
+        LaunchAsyncDeformation(MeshComp, Batch);
+        return;
+    }
 
-                // 반경 내에 있는 버텍스라면?
-                if (DistSq < RadiusSq)
-                {
-                    double Distance = FMath::Sqrt(DistSq);
-                    double Falloff = 1.0 - (Distance * InverseRadius); // 중심일수록 1.0, 멀어지면 0.0
-                    
-                    // [수정] 데미지에 따른 강도 조절 - 계수를 0.05 → 0.15로 상향
-                    float DamageFactor = Hit.Damage * 0.15f; 
-                    float CurrentStrength = DeformStrength * DamageFactor;
-
-                    // 데미지 타입별 가중치 (근접은 더 세게, 원거리는 약하게)
-                    if (Hit.DamageTypeClass && MeleeDamageType && Hit.DamageTypeClass->IsChildOf(MeleeDamageType)) 
-                        CurrentStrength *= 1.5f; 
-                    else if (Hit.DamageTypeClass && RangedDamageType && Hit.DamageTypeClass->IsChildOf(RangedDamageType))
-                        CurrentStrength *= 0.5f; 
-
-                    // 총알 방향으로 밀어넣기
-                    TotalOffset += (FVector3d)Hit.LocalDirection * (double)(CurrentStrength * Falloff);
-                    bModified = true;
-                }
-            }
-            
-            // 실제 버텍스 위치 이동
-            if (bModified)
-            {
-                EditMesh.SetVertex(VertexID, VertexPos + TotalOffset);
-                bAnyModified = true;
-                ModifiedVertexCount++;
-            }
+    // [타임 슬라이싱] 프레임당 예산만큼만 처리하고 나머지는 다음 프레임으로
+    if (bUseTimeSlicing)
+    {
+        SlicedBatch = Batch;
+        SliceCursor = 0;
+        if (!StepSlicedDeformation(SliceBudgetSeconds, true))
+        {
+            QueueSliceContinuation();
         }
-    }, EDynamicMeshChangeType::GeneralEdit);
+        return;
+    }
+
+    // 4. 메쉬 편집 (동기 경로)
+    MeshComp->GetDynamicMesh()->EditMesh([&](UE::Geometry::FDynamicMesh3& EditMesh) 
+    {
+        // [최적화] 오프셋 계산은 워커 스레드에서 청크 단위로, 반영은 한 번에
+        FMDFDeformationKernel::ApplyBatch(EditMesh, *Batch);
+
+        // [★핵심 렌더링 업데이트]
+        // 1. 법선(Normal) 재계산: 표면이 바라보는 방향 갱신
+        // [최적화] 움직인 버텍스의 1-링만 다시 계산 (나머지 법선 오버레이는 그대로)
+        FMDFMeshAttributeUtils::RecomputeNormalsRegion(EditMesh, Batch->ModifiedVertices);
 
-    double MinDist = FMath::Sqrt(MinDebugDistSq);
-    UE_LOG(LogTemp, Warning, TEXT("[MDF Deform] 총 버텍스: %d, 수정된 버텍스: %d"), TotalVertexCount, ModifiedVertexCount);
-    UE_LOG(LogTemp, Warning, TEXT("[MDF Deform] 최소 거리: %.2f, 반경: %.1f"), (float)MinDist, DeformRadius);
+        // 2. [★필수] 탄젠트(Tangent) 재계산
+        // 움직이는 물체(Movable Actor)가 빛을 받을 때 투명해지거나 검게 나오는 것을 방지합니다.
+        // [최적화] 법선이 바뀐 버텍스 + 한 링 경계만 다시 계산
+        FMDFMeshAttributeUtils::RecomputeTangentsRegion(EditMesh, Batch->ModifiedVertices);
+    }, EDynamicMeshChangeType::DeformationEdit, DeformationChangeFlags, true);
+
+    ApplyBatchToVertexHash(*Batch);
+    DisplacementLayer.RecordBatch(*Batch);
+    CommitMeshStateHash(Batch.Get());
+
+    UE_LOG(LogTemp, Warning, TEXT("[MDF Deform] 총 버텍스: %d, 후보 버텍스: %d, 수정된 버텍스: %d"), TotalVertexCount, Batch->Candidates.Num(), Batch->ModifiedVertices.Num());
     
-    if (!bAnyModified)
+    if (Batch->ModifiedVertices.IsEmpty())
     {
         UE_LOG(LogTemp, Error, TEXT("[MDF Deform] >>> 변형 실패! 반경 내 버텍스 없음!"));
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("[MDF Deform] >>> 변형 성공! %d개 버텍스 이동"), ModifiedVertexCount);
+        UE_LOG(LogTemp, Warning, TEXT("[MDF Deform] >>> 변형 성공! %d개 버텍스 이동"), Batch->ModifiedVertices.Num());
     }
 
-    // 인덱스 업데이트 (다음엔 여기부터 처리)
-    LastAppliedIndex = CurrentNum;
-
-    // -------------------------------------------------------------------------
-    // [★핵심 렌더링 업데이트]
-    // -------------------------------------------------------------------------
-    
-    // 1. 법선(Normal) 재계산: 표면이 바라보는 방향 갱신
-    UGeometryScriptLibrary_MeshNormalsFunctions::RecomputeNormals(MeshComp->GetDynamicMesh(), FGeometryScriptCalculateNormalsOptions());
-
-    // 2. [★필수 추가] 탄젠트(Tangent) 재계산
-    // 움직이는 물체(Movable Actor)가 빛을 받을 때 투명해지거나 검게 나오는 것을 방지합니다.
-    UGeometryScriptLibrary_MeshNormalsFunctions::ComputeTangents(MeshComp->GetDynamicMesh(), FGeometryScriptTangentsOptions());
-
     // 3. 충돌 및 렌더링 알림
-    MeshComp->UpdateCollision();
-    MeshComp->NotifyMeshUpdated();
+    UpdateCollisionForBatch(MeshComp, *Batch);
+    NotifyDeformationRenderUpdate(MeshComp, *Batch);
+    ArmFreezeTimer();
+    RequestSimplificationIfOverBudget();
     
     UE_LOG(LogTemp, Warning, TEXT("[MDF Deform] ========== 변형 완료 =========="));
 }
 
 // -----------------------------------------------------------------------------
-// [Step 7] 이펙트 재생 (Multicast)
+// [최적화] 비동기 변형 (더블 버퍼)
 // -----------------------------------------------------------------------------
-void UMDF_DeformableComponent::NetMulticast_PlayEffects_Implementation(const TArray<FMDFHitData>& NewHits)
+bool UMDF_DeformableComponent::IsAsyncDeformationInFlight() const
 {
-    if (IsRunningDedicatedServer()) return; // 데디 서버는 이펙트 재생 안 함
+    return AsyncDeformBatch.IsValid();
+}
 
-    AActor* Owner = GetOwner();
+void UMDF_DeformableComponent::LaunchAsyncDeformation(UDynamicMeshComponent* MeshComp, TSharedPtr<FMDFDeformBatch> Batch)
+{
+    if (!BackBufferMesh.IsValid())
+    {
+        BackBufferMesh = MakeShared<UE::Geometry::FDynamicMesh3>();
+    }
+
+    AsyncDeformBatch = Batch;
+    const int32 Serial = ++AsyncDeformSerial;
+
+    // 프론트 메쉬는 작업이 끝날 때까지 읽기 전용입니다.
+    // (게임 스레드에서 메쉬를 고치는 쪽은 반드시 먼저 FlushPendingDeformation/CancelPendingDeformation 호출)
+    const UE::Geometry::FDynamicMesh3* FrontMesh = MeshComp->GetDynamicMesh()->GetMeshPtr();
+    TSharedPtr<UE::Geometry::FDynamicMesh3> WorkingMesh = BackBufferMesh;
+    TWeakObjectPtr<UMDF_DeformableComponent> WeakThis(this);
+
+    AsyncDeformTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [FrontMesh, WorkingMesh, Batch, WeakThis, Serial]()
+    {
+        // 1. 작업용 메쉬에 현재 모양 복사 (백 버퍼 할당은 재사용)
+        *WorkingMesh = *FrontMesh;
+
+        // 2. 버텍스 이동 + 법선/탄젠트
+        FMDFDeformationKernel::ApplyBatch(*WorkingMesh, *Batch);
+        FMDFMeshAttributeUtils::RecomputeNormalsRegion(*WorkingMesh, Batch->ModifiedVertices);
+        FMDFMeshAttributeUtils::RecomputeTangentsRegion(*WorkingMesh, Batch->ModifiedVertices);
+
+        // 3. 게임 스레드에서 교체
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial]()
+        {
+            if (UMDF_DeformableComponent* This = WeakThis.Get())
+            {
+                This->CompleteAsyncDeformation(Serial, true);
+            }
+        });
+    });
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF Deform] 비동기 작업 시작 (Serial: %d, 히트: %d, 후보: %d)"), Serial, Batch->Hits.Num(), Batch->Candidates.Num());
+}
+
+void UMDF_DeformableComponent::CompleteAsyncDeformation(int32 Serial, bool bLaunchNext)
+{
+    // 이미 반영했거나(Flush) 폐기된(Cancel) 작업이면 무시
+    if (!AsyncDeformBatch.IsValid() || Serial != AsyncDeformSerial) return;
+
+    AsyncDeformTask.Wait();
+    TSharedPtr<FMDFDeformBatch> Batch = MoveTemp(AsyncDeformBatch);
+    AsyncDeformBatch.Reset();
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp) || !IsValid(MeshComp->GetDynamicMesh())) return;
+
+    // 완성된 메쉬를 한 번에 교체 (이전 프론트는 다음 작업의 백 버퍼가 됨)
+    MeshComp->GetDynamicMesh()->EditMesh([this](UE::Geometry::FDynamicMesh3& EditMesh)
+    {
+        Swap(EditMesh, *BackBufferMesh);
+    }, EDynamicMeshChangeType::DeformationEdit, DeformationChangeFlags, true);
+
+    ApplyBatchToVertexHash(*Batch);
+    DisplacementLayer.RecordBatch(*Batch);
+    CommitMeshStateHash(Batch.Get());
+
+    UpdateCollisionForBatch(MeshComp, *Batch);
+    NotifyDeformationRenderUpdate(MeshComp, *Batch);
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF Deform] 비동기 작업 반영 (Serial: %d, 수정된 버텍스: %d)"), Serial, Batch->ModifiedVertices.Num());
+    ArmFreezeTimer();
+
+    if (!bLaunchNext) return; // Flush 중: 호출자가 곧 메쉬를 고침
+
+    // 예산을 넘었으면 단순화가 먼저 (남은 히트는 단순화 완료 후 이어서)
+    RequestSimplificationIfOverBudget();
+
+    // 작업 중에 도착한 히트가 있으면 이어서 다음 작업 예약
+    if (LastAppliedIndex < HitHistory.Num())
+    {
+        ScheduleDeformation();
+    }
+}
+
+// -----------------------------------------------------------------------------
+// [최적화] 삼각형 예산 단순화 (백그라운드)
+// -----------------------------------------------------------------------------
+void UMDF_DeformableComponent::RequestSimplificationIfOverBudget()
+{
+    if (TriangleBudget <= 0 || bUsingStaticProxy || IsDeformationInProgress()) return;
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp) || !IsValid(MeshComp->GetDynamicMesh())) return;
+
+    const int32 NumTriangles = MeshComp->GetDynamicMesh()->GetTriangleCount();
+    if (NumTriangles <= TriangleBudget) return;
+
+    // 고정된 경계 때문에 예산 아래로 못 내려간 메쉬는 여유분만큼 더 늘어났을 때만 다시 시도
+    const int32 TargetTriangles = FMath::Max(1, FMath::FloorToInt32(TriangleBudget * SimplifyTargetRatio));
+    if (LastSimplifiedTriangleCount > 0 && NumTriangles - LastSimplifiedTriangleCount < TriangleBudget - TargetTriangles) return;
+
+    if (!BackBufferMesh.IsValid())
+    {
+        BackBufferMesh = MakeShared<UE::Geometry::FDynamicMesh3>();
+    }
+
+    // 손상 버텍스(= 찌그러진 자리, 세분화/절단으로 생긴 자리)는 고정
+    // 변위 기록은 절단/세분화/이전 단순화에서 비워지므로, 토폴로지 변경에도 유지되는 손상 집합을 씀
+    SimplifyPinnedVertices = MakeShared<TArray<int32>>(DisplacementLayer.GetDamagedVertices().Array());
+    const int32 NumPinned = SimplifyPinnedVertices->Num();
+
+    bSimplifyInFlight = true;
+    const int32 Serial = ++SimplifySerial;
+
+    // 비동기 변형과 같은 규칙: 작업이 끝날 때까지 프론트 메쉬는 읽기 전용
+    const UE::Geometry::FDynamicMesh3* FrontMesh = MeshComp->GetDynamicMesh()->GetMeshPtr();
+    TSharedPtr<UE::Geometry::FDynamicMesh3> WorkingMesh = BackBufferMesh;
+    TSharedPtr<TArray<int32>> PinnedVertices = SimplifyPinnedVertices;
+    TWeakObjectPtr<UMDF_DeformableComponent> WeakThis(this);
+
+    SimplifyTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [FrontMesh, WorkingMesh, PinnedVertices, TargetTriangles, WeakThis, Serial]()
+    {
+        *WorkingMesh = *FrontMesh;
+        FMDFMeshSimplifier::SimplifyToTriangleCount(*WorkingMesh, TargetTriangles, *PinnedVertices);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial]()
+        {
+            if (UMDF_DeformableComponent* This = WeakThis.Get())
+            {
+                This->CompleteSimplification(Serial, true);
+            }
+        });
+    });
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF] 삼각형 예산 초과: 단순화 시작 (%d -> 목표 %d, 고정 버텍스: %d)"), NumTriangles, TargetTriangles, NumPinned);
+}
+
+void UMDF_DeformableComponent::CompleteSimplification(int32 Serial, bool bLaunchNext)
+{
+    // 이미 반영했거나(Flush) 폐기된(Cancel) 작업이면 무시
+    if (!bSimplifyInFlight || Serial != SimplifySerial) return;
+
+    SimplifyTask.Wait();
+    bSimplifyInFlight = false;
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp) || !IsValid(MeshComp->GetDynamicMesh())) return;
+
+    // 단순화된 메쉬로 한 번에 교체
+    int32 NumBefore = 0;
+    int32 NumAfter = 0;
+    MeshComp->GetDynamicMesh()->EditMesh([&](UE::Geometry::FDynamicMesh3& EditMesh)
+    {
+        NumBefore = EditMesh.TriangleCount();
+        Swap(EditMesh, *BackBufferMesh);
+        NumAfter = EditMesh.TriangleCount();
+    }, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+
+    // 교체되어 나온 예산 초과 메쉬는 바로 반환 (비동기 변형은 다음 작업에서 다시 할당)
+    BackBufferMesh.Reset();
+    LastSimplifiedTriangleCount = NumAfter;
+
+    // ID가 모두 바뀌었으므로 해시는 다음 배치에서 재생성, 수리는 스냅샷 전체 복사
+    // 손상 집합은 압축 후 ID로 매핑된 고정 버텍스로 교체 (고정 버텍스는 붕괴되지 않으므로 그대로 남아 있음)
+    VertexHash.Reset();
+    DisplacementLayer.MarkTopologyChanged();
+    if (SimplifyPinnedVertices.IsValid())
+    {
+        DisplacementLayer.SetDamagedVertices(*SimplifyPinnedVertices);
+        SimplifyPinnedVertices.Reset();
+    }
+    InvalidateMeshStateHash();
+
+    if (bDeformationStateMaterialized)
+    {
+        RebuildCollisionChunks(MeshComp);
+    }
+    else if (!IsValid(CollisionProxyComponent))
+    {
+        MeshComp->UpdateCollision(false);
+    }
+    MeshComp->NotifyMeshUpdated();
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF] 단순화 반영 (삼각형: %d -> %d)"), NumBefore, NumAfter);
+
+    // 단순화 중에 도착한 히트가 있으면 이어서 처리
+    if (bLaunchNext && LastAppliedIndex < HitHistory.Num())
+    {
+        ScheduleDeformation();
+    }
+}
+
+// -----------------------------------------------------------------------------
+// [최적화] 프레임 예산 기반 타임 슬라이싱
+// -----------------------------------------------------------------------------
+bool UMDF_DeformableComponent::IsSlicedDeformationInProgress() const
+{
+    return SlicedBatch.IsValid();
+}
+
+void UMDF_DeformableComponent::QueueSliceContinuation()
+{
+    // 스케줄러가 있으면 다음 프레임 틱에서 다른 메쉬들과 예산을 나눠 이어서 처리
+    if (UMDF_DeformationSubsystem* Scheduler = UMDF_DeformationSubsystem::Get(this))
+    {
+        Scheduler->RequestDeformation(this);
+        return;
+    }
+
+    // 스케줄러가 없는 월드에서는 다음 틱 타이머로 (버텍스 커서 위치부터 재개)
+    SliceTimerHandle = GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UMDF_DeformableComponent::ContinueSlicedDeformation);
+}
+
+void UMDF_DeformableComponent::ContinueSlicedDeformation()
+{
+    SliceTimerHandle.Invalidate();
+
+    const double BudgetSeconds = FMath::Max(0.1f, TimeSliceBudgetMs) * 0.001;
+    if (!StepSlicedDeformation(BudgetSeconds, true) && IsSlicedDeformationInProgress())
+    {
+        QueueSliceContinuation();
+    }
+}
+
+bool UMDF_DeformableComponent::StepSlicedDeformation(double BudgetSeconds, bool bLaunchNext)
+{
+    if (!SlicedBatch.IsValid()) return true;
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp) || !IsValid(MeshComp->GetDynamicMesh()))
+    {
+        SlicedBatch.Reset();
+        return true;
+    }
+
+    const double Deadline = FPlatformTime::Seconds() + BudgetSeconds;
+    const int32 NumCandidates = SlicedBatch->Candidates.Num();
+    bool bDone = false;
+
+    // 중간 조각에서는 변경 이벤트를 보내지 않습니다. (렌더/충돌 갱신은 마지막 조각에서 한 번만)
+    MeshComp->GetDynamicMesh()->EditMesh([&](UE::Geometry::FDynamicMesh3& EditMesh)
+    {
+        // 예산이 아무리 작아도 한 조각은 처리해서 항상 진행되도록 합니다.
+        do
+        {
+            const int32 End = FMath::Min(SliceCursor + SliceGranularity, NumCandidates);
+            FMDFDeformationKernel::ApplyBatchRange(EditMesh, *SlicedBatch, SliceCursor, End);
+            SliceCursor = End;
+        }
+        while (SliceCursor < NumCandidates && FPlatformTime::Seconds() < Deadline);
+
+        bDone = SliceCursor >= NumCandidates;
+        if (bDone)
+        {
+            FMDFMeshAttributeUtils::RecomputeNormalsRegion(EditMesh, SlicedBatch->ModifiedVertices);
+            FMDFMeshAttributeUtils::RecomputeTangentsRegion(EditMesh, SlicedBatch->ModifiedVertices);
+        }
+    }, EDynamicMeshChangeType::DeformationEdit, DeformationChangeFlags, true);
+
+    if (!bDone) return false;
+
+    TSharedPtr<FMDFDeformBatch> Batch = MoveTemp(SlicedBatch);
+    SlicedBatch.Reset();
+
+    ApplyBatchToVertexHash(*Batch);
+    DisplacementLayer.RecordBatch(*Batch);
+    CommitMeshStateHash(Batch.Get());
+
+    UpdateCollisionForBatch(MeshComp, *Batch);
+    NotifyDeformationRenderUpdate(MeshComp, *Batch);
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF Deform] 타임 슬라이스 완료 (후보: %d, 수정된 버텍스: %d)"), NumCandidates, Batch->ModifiedVertices.Num());
+    ArmFreezeTimer();
+
+    if (!bLaunchNext) return true; // Flush 중: 호출자가 곧 메쉬를 고침
+
+    RequestSimplificationIfOverBudget();
+
+    // 슬라이스 중에 도착한 히트가 있으면 이어서 예약
+    if (LastAppliedIndex < HitHistory.Num())
+    {
+        ScheduleDeformation();
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// [최적화] 진행 중인 작업 정리 (비동기 + 타임 슬라이싱 공통)
+// -----------------------------------------------------------------------------
+bool UMDF_DeformableComponent::IsDeformationInProgress() const
+{
+    return IsAsyncDeformationInFlight() || IsSlicedDeformationInProgress() || IsSimplificationInFlight();
+}
+
+void UMDF_DeformableComponent::FlushPendingDeformation()
+{
+    // 호출자가 메쉬를 고치므로 쿠킹 중인 고정 전환은 버림
+    CancelPendingFreeze();
+
+    if (IsAsyncDeformationInFlight())
+    {
+        CompleteAsyncDeformation(AsyncDeformSerial, false);
+    }
+
+    if (IsSlicedDeformationInProgress())
+    {
+        GetWorld()->GetTimerManager().ClearTimer(SliceTimerHandle);
+
+        // 남은 조각을 예산 없이 끝까지 처리 (대기 중인 히트는 호출자의 메쉬 수정 이후로 미룸)
+        StepSlicedDeformation(DBL_MAX, false);
+    }
+
+    if (IsSimplificationInFlight())
+    {
+        // 단순화는 교체만 남았으므로 끝까지 기다렸다가 반영
+        CompleteSimplification(SimplifySerial, false);
+    }
+
+    // 미뤄둔 히트는 다음 스케줄러 틱(= 호출자의 메쉬 수정 이후)에 처리
+    if (LastAppliedIndex < HitHistory.Num())
+    {
+        if (UMDF_DeformationSubsystem* Scheduler = UMDF_DeformationSubsystem::Get(this))
+        {
+            Scheduler->RequestDeformation(this);
+        }
+    }
+}
+
+void UMDF_DeformableComponent::CancelPendingDeformation()
+{
+    CancelPendingFreeze();
+
+    if (IsAsyncDeformationInFlight())
+    {
+        // 작업이 프론트 메쉬를 읽고 있을 수 있으므로 끝날 때까지 기다린 뒤 결과만 버립니다.
+        AsyncDeformTask.Wait();
+        AsyncDeformBatch.Reset();
+        ++AsyncDeformSerial;
+    }
+
+    if (IsSlicedDeformationInProgress())
+    {
+        if (UWorld* World = GetWorld())
+        {
+            World->GetTimerManager().ClearTimer(SliceTimerHandle);
+        }
+
+        // 이미 반영된 조각은 메쉬에 남아 있으므로 해시/변위 기록은 맞춰 둡니다. (수리 시 함께 되돌아감)
+        ApplyBatchToVertexHash(*SlicedBatch);
+        DisplacementLayer.RecordBatch(*SlicedBatch);
+        InvalidateMeshStateHash();
+        SlicedBatch.Reset();
+        SliceCursor = 0;
+    }
+
+    if (IsSimplificationInFlight())
+    {
+        SimplifyTask.Wait();
+        bSimplifyInFlight = false;
+        ++SimplifySerial;
+        SimplifyPinnedVertices.Reset();
+    }
+}
+
+// -----------------------------------------------------------------------------
+// [최적화] 충돌 청크
+// -----------------------------------------------------------------------------
+UDynamicMeshComponent* UMDF_DeformableComponent::GetTargetMeshComponent() const
+{
+    if (UDynamicMeshComponent* Cached = CachedTargetMesh.Get())
+    {
+        return Cached;
+    }
+
+    AActor* Owner = GetOwner();
+    if (!IsValid(Owner)) return nullptr;
+
+    TInlineComponentArray<UDynamicMeshComponent*> MeshComponents(Owner);
+    for (UDynamicMeshComponent* Candidate : MeshComponents)
+    {
+        if (IsValid(Candidate) && !Candidate->IsA<UMDF_CollisionChunkComponent>())
+        {
+            CachedTargetMesh = Candidate;
+            return Candidate;
+        }
+    }
+    return nullptr;
+}
+
+bool UMDF_DeformableComponent::ShouldUseCollisionChunks() const
+{
+    // 에디터 프리뷰(OnConstruction)에서는 원본 메쉬 충돌을 그대로 씁니다.
+    const UWorld* World = GetWorld();
+    return bUseChunkedCollision && HasBegunPlay() && World && World->IsGameWorld();
+}
+
+void UMDF_DeformableComponent::RebuildCollisionChunks(UDynamicMeshComponent* MeshComp, const FBox* DirtyRegion)
+{
+    if (!IsValid(MeshComp) || !IsValid(MeshComp->GetDynamicMesh())) return;
+
+    // 충돌 프록시가 충돌을 맡으면 렌더 메쉬 토폴로지와 무관 (렌더 메쉬는 충돌 없음 유지)
+    if (IsValid(CollisionProxyComponent))
+    {
+        MeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+        return;
+    }
+
+    if (!SavedMeshCollisionEnabled.IsSet())
+    {
+        // 가속 구조만 해제한 고정 상태면 원본 충돌은 꺼져 있으므로 고정 전 설정을 씀
+        SavedMeshCollisionEnabled = IsValid(FrozenCollisionComponent) && ProxySavedCollision.IsSet()
+            ? ProxySavedCollision.GetValue()
+            : MeshComp->GetCollisionEnabled();
+    }
+
+    // 청크를 쓰지 않거나 원래 충돌이 꺼져 있던 메쉬면 기존 방식 (메쉬 전체)
+    if (!ShouldUseCollisionChunks() || SavedMeshCollisionEnabled.GetValue() == ECollisionEnabled::NoCollision)
+    {
+        DestroyCollisionChunks(MeshComp);
+        DestroyFrozenCollision(MeshComp);
+        MeshComp->UpdateCollision(false);
+        return;
+    }
+
+    // 1. 격자 분할
+    MeshComp->GetDynamicMesh()->ProcessMesh([this](const UE::Geometry::FDynamicMesh3& ReadMesh)
+    {
+        CollisionChunkLayout.Build(ReadMesh, (double)CollisionChunkSize, MaxCollisionChunks);
+    });
+
+    // [최적화] 원본 메쉬 충돌을 처음 넘겨받는 경우에도 비동기 쿠킹
+    // 원본 메쉬 바디는 초기화 때 이미 쿠킹되어 있으므로, 청크 바디가 모두 준비될 때까지 원본이 충돌을 맡습니다.
+    const bool bTakingOverCollision = CollisionChunks.IsEmpty() || bCollisionTakeoverPending;
+
+    // 2. 같은 셀의 기존 청크 컴포넌트는 재사용, 바뀐 청크만 다시 쿠킹
+    TMap<FIntVector, UMDF_CollisionChunkComponent*> ExistingChunks;
+    for (UMDF_CollisionChunkComponent* Chunk : CollisionChunks)
+    {
+        if (IsValid(Chunk))
+        {
+            ExistingChunks.Add(Chunk->ChunkCell, Chunk);
+        }
+    }
+
+    TArray<TObjectPtr<UMDF_CollisionChunkComponent>> NewChunks;
+    NewChunks.Reserve(CollisionChunkLayout.Num());
+    int32 NumCooked = 0;
+
+    for (int32 ChunkIndex = 0; ChunkIndex < CollisionChunkLayout.Num(); ++ChunkIndex)
+    {
+        const FMDFCollisionChunkLayout::FChunk& ChunkInfo = CollisionChunkLayout.GetChunk(ChunkIndex);
+
+        UMDF_CollisionChunkComponent* Chunk = nullptr;
+        ExistingChunks.RemoveAndCopyValue(ChunkInfo.Cell, Chunk);
+
+        const bool bDirty = !IsValid(Chunk)
+            || DirtyRegion == nullptr
+            || ChunkInfo.Bounds.Intersect(*DirtyRegion)
+            || Chunk->GetDynamicMesh()->GetTriangleCount() != ChunkInfo.Triangles.Num();
+
+        if (!IsValid(Chunk))
+        {
+            Chunk = CreateCollisionChunk(MeshComp, ChunkInfo.Cell);
+            if (bTakingOverCollision)
+            {
+                Chunk->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+            }
+        }
+
+        // 청크 메쉬는 항상 새 매핑 순서로 다시 채웁니다. (불리언 등으로 원본 ID가 바뀌면 청크 버텍스 순서도 달라짐)
+        // 변경 이벤트를 보내지 않으므로 쿠킹은 실제로 바뀐 청크에서만 일어납니다.
+        UE::Geometry::FDynamicMesh3 ChunkMesh;
+        MeshComp->GetDynamicMesh()->ProcessMesh([&](const UE::Geometry::FDynamicMesh3& ReadMesh)
+        {
+            CollisionChunkLayout.BuildChunkMesh(ReadMesh, ChunkIndex, ChunkMesh);
+        });
+
+        Chunk->GetDynamicMesh()->EditMesh([&ChunkMesh](UE::Geometry::FDynamicMesh3& EditMesh)
+        {
+            EditMesh = MoveTemp(ChunkMesh);
+        }, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+
+        if (bDirty)
+        {
+            Chunk->UpdateCollision(false);
+            NumCooked++;
+        }
+
+        NewChunks.Add(Chunk);
+    }
+
+    // 3. 사라진 셀의 청크 제거
+    for (const TPair<FIntVector, UMDF_CollisionChunkComponent*>& Leftover : ExistingChunks)
+    {
+        Leftover.Value->DestroyComponent();
+    }
+    CollisionChunks = MoveTemp(NewChunks);
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF Collision] 청크 재구성: %d개 중 %d개 쿠킹"), CollisionChunks.Num(), NumCooked);
+
+    // 4. 원본 메쉬는 렌더링만 담당 (인계 중이면 청크 바디가 준비된 뒤에 넘김)
+    if (!bTakingOverCollision)
+    {
+        MeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+        return;
+    }
+
+    bCollisionTakeoverPending = true;
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().SetTimer(CollisionTakeoverTimerHandle, this, &UMDF_DeformableComponent::PollCollisionTakeover, 0.05f, true);
+    }
+    PollCollisionTakeover();
+}
+
+void UMDF_DeformableComponent::PollCollisionTakeover()
+{
+    if (!bCollisionTakeoverPending) return;
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp)) return;
+
+    for (UMDF_CollisionChunkComponent* Chunk : CollisionChunks)
+    {
+        const UBodySetup* BodySetup = IsValid(Chunk) ? Chunk->GetBodySetup() : nullptr;
+        if (BodySetup && !BodySetup->bCreatedPhysicsMeshes) return;
+    }
+
+    // 쿠킹된 바디로 물리 상태만 다시 만들고 같은 프레임에 원본 충돌을 끔 (충돌 공백/중복 없음)
+    const ECollisionEnabled::Type CollisionEnabled = SavedMeshCollisionEnabled.Get(ECollisionEnabled::QueryAndPhysics);
+    for (UMDF_CollisionChunkComponent* Chunk : CollisionChunks)
+    {
+        if (IsValid(Chunk))
+        {
+            Chunk->SetCollisionEnabled(CollisionEnabled);
+        }
+    }
+    MeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+    // 고정 상태에서 충돌을 맡고 있던 단순화 바디도 내려놓음 (원본 메쉬 충돌은 꺼 둔 그대로)
+    ProxySavedCollision.Reset();
+    DestroyFrozenCollision(MeshComp);
+
+    bCollisionTakeoverPending = false;
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(CollisionTakeoverTimerHandle);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF Collision] 청크 충돌 인계 완료 (%s, 청크: %d)"), *GetNameSafe(GetOwner()), CollisionChunks.Num());
+}
+
+UMDF_CollisionChunkComponent* UMDF_DeformableComponent::CreateCollisionChunk(UDynamicMeshComponent* MeshComp, const FIntVector& Cell)
+{
+    UMDF_CollisionChunkComponent* Chunk = NewObject<UMDF_CollisionChunkComponent>(GetOwner(), NAME_None, RF_Transient);
+    Chunk->ChunkCell = Cell;
+
+    // 원본 메쉬 로컬 공간 그대로 (상대 트랜스폼 Identity)
+    Chunk->SetMobility(MeshComp->Mobility);
+    Chunk->SetupAttachment(MeshComp);
+
+    // 충돌 설정 이어받기
+    Chunk->SetCollisionProfileName(MeshComp->GetCollisionProfileName());
+    Chunk->SetCollisionObjectType(MeshComp->GetCollisionObjectType());
+    Chunk->SetCollisionResponseToChannels(MeshComp->GetCollisionResponseToChannels());
+    Chunk->SetCollisionEnabled(SavedMeshCollisionEnabled.Get(ECollisionEnabled::QueryAndPhysics));
+    Chunk->SetGenerateOverlapEvents(MeshComp->GetGenerateOverlapEvents());
+    Chunk->SetCanEverAffectNavigation(MeshComp->CanEverAffectNavigation());
+
+    Chunk->RegisterComponent();
+    return Chunk;
+}
+
+void UMDF_DeformableComponent::DestroyCollisionChunks(UDynamicMeshComponent* MeshComp)
+{
+    for (UMDF_CollisionChunkComponent* Chunk : CollisionChunks)
+    {
+        if (IsValid(Chunk))
+        {
+            Chunk->DestroyComponent();
+        }
+    }
+    CollisionChunks.Reset();
+    CollisionChunkLayout.Reset();
+
+    bCollisionTakeoverPending = false;
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(CollisionTakeoverTimerHandle);
+    }
+
+    if (SavedMeshCollisionEnabled.IsSet() && IsValid(MeshComp) && !IsValid(CollisionProxyComponent))
+    {
+        MeshComp->SetCollisionEnabled(SavedMeshCollisionEnabled.GetValue());
+    }
+}
+
+void UMDF_DeformableComponent::UpdateCollisionForBatch(UDynamicMeshComponent* MeshComp, const FMDFDeformBatch& Batch)
+{
+    // 충돌 프록시는 배치 준비 시점에 이미 갱신됨
+    if (IsValid(CollisionProxyComponent)) return;
+
+    // 세분화로 삼각형이 늘었으면 청크 매핑부터 다시 (타격 반경에 걸치는 청크만 쿠킹)
+    if (Batch.bTopologyChanged)
+    {
+        FBox DirtyRegion(ForceInit);
+        for (const FMDFKernelHit& Hit : Batch.Hits)
+        {
+            DirtyRegion += FBox::BuildAABB(Hit.Location, FVector(Hit.GetReach(Batch.Radius)));
+        }
+        RebuildCollisionChunks(MeshComp, &DirtyRegion);
+        return;
+    }
+
+    if (Batch.ModifiedVertices.IsEmpty()) return;
+
+    // 변경 이벤트를 지연시키므로 bOnlyIfPending = false로 직접 갱신
+    if (CollisionChunks.IsEmpty() || !CollisionChunkLayout.IsBuilt())
+    {
+        MeshComp->UpdateCollision(false);
+        return;
+    }
+
+    TMap<int32, TArray<FMDFCollisionChunkLayout::FVertexUpdate>> Updates;
+    MeshComp->GetDynamicMesh()->ProcessMesh([&](const UE::Geometry::FDynamicMesh3& ReadMesh)
+    {
+        CollisionChunkLayout.CollectVertexUpdates(ReadMesh, Batch.ModifiedVertices, Updates);
+    });
+
+    for (const TPair<int32, TArray<FMDFCollisionChunkLayout::FVertexUpdate>>& Pair : Updates)
+    {
+        UMDF_CollisionChunkComponent* Chunk = CollisionChunks.IsValidIndex(Pair.Key) ? CollisionChunks[Pair.Key].Get() : nullptr;
+        if (!IsValid(Chunk)) continue;
+
+        Chunk->GetDynamicMesh()->EditMesh([&Pair](UE::Geometry::FDynamicMesh3& ChunkMesh)
+        {
+            for (const FMDFCollisionChunkLayout::FVertexUpdate& Update : Pair.Value)
+            {
+                ChunkMesh.SetVertex(Update.ChunkVertexID, Update.Position);
+            }
+        }, EDynamicMeshChangeType::DeformationEdit, EDynamicMeshAttributeChangeFlags::VertexPositions, true);
+
+        // 건드린 청크만 비동기 재쿠킹
+        Chunk->UpdateCollision(false);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF Collision] 재쿠킹 청크: %d / %d"), Updates.Num(), CollisionChunks.Num());
+}
+
+// -----------------------------------------------------------------------------
+// [최적화] 위치/법선 전용 빠른 렌더 갱신
+// -----------------------------------------------------------------------------
+void UMDF_DeformableComponent::NotifyDeformationRenderUpdate(UDynamicMeshComponent* MeshComp, const FMDFDeformBatch& Batch)
+{
+    // [최적화] 헤드리스 서버는 렌더 프록시가 없음 (토폴로지가 바뀔 때만 바운드 갱신을 위해 알림)
+    if (IsHeadless() && !Batch.bTopologyChanged) return;
+
+    // 세분화로 토폴로지가 바뀐 배치는 프록시를 새로 만들어야 함
+    if (CVarMDFFastRenderUpdate.GetValueOnGameThread() == 0 || Batch.bTopologyChanged)
+    {
+        MeshComp->NotifyMeshUpdated();
+        return;
+    }
+
+    // 움직인 버텍스가 없으면 버퍼도 그대로
+    if (Batch.ModifiedVertices.IsEmpty()) return;
+
+    // 법선/탄젠트가 바뀐 버텍스를 꼭짓점으로 갖는 삼각형만 다시 올립니다.
+    // (토폴로지를 바꾸는 쪽(초기화/절단)은 항상 NotifyMeshUpdated로 프록시를 새로 만들므로 삼각형 구성은 프록시와 같음)
+    TArray<int32> Triangles;
+    int32 TotalTriangles = 0;
+    MeshComp->GetDynamicMesh()->ProcessMesh([&](const UE::Geometry::FDynamicMesh3& ReadMesh)
+    {
+        TBitArray<> VertexMask;
+        FMDFMeshAttributeUtils::CollectAttributeRegion(ReadMesh, Batch.ModifiedVertices, VertexMask, Triangles);
+        TotalTriangles = ReadMesh.TriangleCount();
+    });
+
+    const EMeshRenderAttributeFlags UpdatedAttributes = EMeshRenderAttributeFlags::Positions | EMeshRenderAttributeFlags::VertexNormals;
+
+    if (Triangles.Num() * 2 > TotalTriangles)
+    {
+        // 절반 이상이면 버퍼 통째로 갱신하는 쪽이 더 쌈
+        MeshComp->FastNotifyPositionsUpdated(true, false, false);
+    }
+    else
+    {
+        MeshComp->FastNotifyTriangleVerticesUpdated(Triangles, UpdatedAttributes);
+    }
+}
+
+void UMDF_DeformableComponent::ApplyBatchToVertexHash(const FMDFDeformBatch& Batch)
+{
+    for (int32 Index = 0; Index < Batch.ModifiedVertices.Num(); ++Index)
+    {
+        VertexHash.UpdateVertex(Batch.ModifiedVertices[Index], Batch.OldPositions[Index], Batch.NewPositions[Index]);
+    }
+
+    // 변형으로 늘어난 변은 세분화 시드 반경에 반영 (세분화를 쓸 때만, 움직인 버텍스의 한 링만 검사)
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (RefineTargetEdgeLength > 0.0f && IsValid(MeshComp) && !Batch.ModifiedVertices.IsEmpty())
+    {
+        MeshComp->GetDynamicMesh()->ProcessMesh([&](const UE::Geometry::FDynamicMesh3& Mesh)
+        {
+            VertexHash.NoteMovedVertices(Mesh, Batch.ModifiedVertices);
+        });
+    }
+}
+
+// -----------------------------------------------------------------------------
+// [최적화] 저해상도 충돌 프록시
+// -----------------------------------------------------------------------------
+TSharedPtr<const UE::Geometry::FDynamicMesh3> UMDF_DeformableComponent::FindCollisionProxyBase() const
+{
+    UMDF_BaseMeshCache* Cache = UMDF_BaseMeshCache::Get();
+    if (!Cache)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[MDF] 충돌 프록시는 베이스 메쉬 캐시가 필요합니다. (MDF.BaseMeshCache.Enable 0) 렌더 메쉬 충돌을 사용합니다."));
+        return nullptr;
+    }
+
+    // 직접 만든 프록시가 우선, 없으면 원본을 단순화
+    return IsValid(CollisionProxyMesh)
+        ? Cache->FindOrBuildCollisionProxy(CollisionProxyMesh, 0)
+        : Cache->FindOrBuildCollisionProxy(SourceStaticMesh, AutoCollisionProxyTriangles);
+}
+
+void UMDF_DeformableComponent::ResetCollisionProxy(UDynamicMeshComponent* MeshComp)
+{
+    const UWorld* World = GetWorld();
+    if (IsHeadless() || !HasCollisionProxy() || !World || !World->IsGameWorld())
+    {
+        DestroyCollisionProxy(MeshComp);
+        return;
+    }
+
+    TSharedPtr<const UE::Geometry::FDynamicMesh3> ProxyBase = FindCollisionProxyBase();
+    if (!ProxyBase.IsValid())
+    {
+        DestroyCollisionProxy(MeshComp);
+        return;
+    }
+
+    if (!IsValid(CollisionProxyComponent))
+    {
+        // 렌더 메쉬(또는 청크)가 갖고 있던 충돌 설정을 프록시가 이어받음
+        DestroyCollisionChunks(MeshComp);
+        if (!SavedMeshCollisionEnabled.IsSet())
+        {
+            SavedMeshCollisionEnabled = MeshComp->GetCollisionEnabled();
+        }
+        if (SavedMeshCollisionEnabled.GetValue() == ECollisionEnabled::NoCollision) return;
+
+        CollisionProxyComponent = CreateCollisionChunk(MeshComp, FIntVector::ZeroValue);
+    }
+
+    CollisionProxyComponent->GetDynamicMesh()->EditMesh([&ProxyBase](UE::Geometry::FDynamicMesh3& EditMesh)
+    {
+        EditMesh.Copy(*ProxyBase);
+    }, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+    CollisionProxyAppliedIndex = 0;
+
+    // 프록시는 작으므로 동기 쿠킹 (렌더 메쉬 충돌을 끄는 순간 공백이 없도록)
+    CollisionProxyComponent->bUseAsyncCooking = false;
+    CollisionProxyComponent->UpdateCollision(false);
+    CollisionProxyComponent->bUseAsyncCooking = true;
+
+    MeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF] 충돌 프록시 사용 (%s, 삼각형: %d)"), *GetNameSafe(GetOwner()), ProxyBase->TriangleCount());
+}
+
+void UMDF_DeformableComponent::DestroyCollisionProxy(UDynamicMeshComponent* MeshComp)
+{
+    if (!IsValid(CollisionProxyComponent)) return;
+
+    CollisionProxyComponent->DestroyComponent();
+    CollisionProxyComponent = nullptr;
+
+    if (SavedMeshCollisionEnabled.IsSet() && IsValid(MeshComp))
+    {
+        MeshComp->SetCollisionEnabled(SavedMeshCollisionEnabled.GetValue());
+    }
+}
+
+void UMDF_DeformableComponent::DeformCollisionProxy(int32 EndIndex)
+{
+    if (CollisionProxyAppliedIndex >= EndIndex) return;
+
+    FMDFDeformBatch ProxyBatch;
+    ProxyBatch.Radius = (double)DeformRadius;
+    ProxyBatch.Falloff = DeformationProfile ? DeformationProfile->MakeFalloffParams() : FMDFFalloffParams();
+    BuildKernelHits(CollisionProxyAppliedIndex, EndIndex, ProxyBatch.Hits);
+    CollisionProxyAppliedIndex = EndIndex;
+
+    CollisionProxyComponent->GetDynamicMesh()->EditMesh([&ProxyBatch](UE::Geometry::FDynamicMesh3& EditMesh)
+    {
+        // 버텍스가 수백 개 수준이므로 공간 해시 없이 전부 후보 (반경 판정은 커널이 함)
+        ProxyBatch.Candidates.Reserve(EditMesh.VertexCount());
+        for (const int32 VertexID : EditMesh.VertexIndicesItr())
+        {
+            ProxyBatch.Candidates.Add(VertexID);
+        }
+        FMDFDeformationKernel::ApplyBatch(EditMesh, ProxyBatch);
+    }, EDynamicMeshChangeType::DeformationEdit, EDynamicMeshAttributeChangeFlags::VertexPositions, true);
+
+    if (!ProxyBatch.ModifiedVertices.IsEmpty())
+    {
+        CollisionProxyComponent->UpdateCollision(false);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// [최적화] 타격 지점 국소 세분화
+// -----------------------------------------------------------------------------
+void UMDF_DeformableComponent::RefineAroundHits(UDynamicMeshComponent* MeshComp, FMDFDeformBatch& Batch)
+{
+    // 세분화는 프론트 메쉬를 직접 바꾸므로 읽고 있는 작업이 없어야 함 (ApplyPendingHits에서만 호출)
+    check(!IsDeformationInProgress());
+
+    TArray<int32> NewVertices;
+    MeshComp->GetDynamicMesh()->EditMesh([&](UE::Geometry::FDynamicMesh3& EditMesh)
+    {
+        // 시드는 공간 해시로: 도달 거리 + 최대 변 길이 안의 버텍스 (그 밖의 변은 타격 구에 닿을 수 없음)
+        EnsureVertexHash(EditMesh);
+
+        TArray<int32> SeedVertices;
+        TSet<FIntVector> VisitedCells;
+        for (const FMDFKernelHit& Hit : Batch.Hits)
+        {
+            VertexHash.GatherCandidates(Hit.Location, Hit.GetReach(Batch.Radius) + VertexHash.GetMaxEdgeLength(), VisitedCells, SeedVertices);
+        }
+
+        FMDFMeshRefiner::RefineAroundHits(EditMesh, Batch.Hits, SeedVertices, Batch.Radius, (double)RefineTargetEdgeLength, MaxRefineVerticesPerBatch, NewVertices);
+
+        // 새 버텍스만 해시에 추가 (이등분은 변을 늘리지 않으므로 최대 변 길이는 그대로)
+        for (const int32 VertexID : NewVertices)
+        {
+            VertexHash.InsertVertex(VertexID, EditMesh.GetVertex(VertexID));
+        }
+    }, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+
+    if (NewVertices.IsEmpty()) return;
+
+    // 렌더/충돌은 변형 결과와 함께 한 번에 재구성 (UpdateCollisionForBatch / NotifyDeformationRenderUpdate)
+    Batch.bTopologyChanged = true;
+
+    // 버텍스 ID가 스냅샷과 달라졌으므로 수리는 스냅샷 전체 복사로 (원래의 가벼운 메쉬로 돌아감)
+    // 새 버텍스는 찌그러질 자리이므로 단순화에서 고정되도록 손상으로 표시
+    DisplacementLayer.MarkTopologyChanged();
+    DisplacementLayer.AddDamagedVertices(NewVertices);
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF Deform] 국소 세분화: 버텍스 %d개 추가 (목표 변 길이: %.1f)"), NewVertices.Num(), RefineTargetEdgeLength);
+}
+
+// -----------------------------------------------------------------------------
+// [Step 7] 이펙트 재생 (Multicast)
+// -----------------------------------------------------------------------------
+void UMDF_DeformableComponent::NetMulticast_PlayEffects_Implementation(const TArray<FMDFHitData>& NewHits)
+{
+    if (IsRunningDedicatedServer()) return; // 데디 서버는 이펙트 재생 안 함
+
+    AActor* Owner = GetOwner();
     if (!IsValid(Owner)) return;
 
-    UDynamicMeshComponent* MeshComp = Owner->FindComponentByClass<UDynamicMeshComponent>();
-    if (!IsValid(MeshComp)) return;
-    
-    const FTransform& ComponentTransform = MeshComp->GetComponentTransform();
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp)) return;
+    
+    const FTransform& ComponentTransform = MeshComp->GetComponentTransform();
+
+    for (const FMDFHitData& Hit : NewHits)
+    {
+        FVector WorldHitLoc = ComponentTransform.TransformPosition(Hit.LocalLocation);
+        FVector WorldHitDir = ComponentTransform.TransformVector(Hit.LocalDirection);
+
+        // 나이아가라 파티클 (파편)
+        if (IsValid(DebrisSystem))
+        {
+            UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), DebrisSystem, WorldHitLoc, WorldHitDir.Rotation());
+        }
+
+        // 타격 사운드
+        if (IsValid(ImpactSound))
+        {
+            UGameplayStatics::PlaySoundAtLocation(GetWorld(), ImpactSound, WorldHitLoc, FRotator::ZeroRotator, 1.0f, 1.0f, 0.0f, ImpactAttenuation);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// [초기화] 스태틱 메쉬 -> 다이나믹 메쉬 복사
+// -----------------------------------------------------------------------------
+void UMDF_DeformableComponent::InitializeDynamicMesh()
+{
+    if (!IsValid(SourceStaticMesh)) return;
+
+    // [비동기/타임 슬라이싱] 메쉬를 통째로 갈아엎으므로 진행 중인 작업 결과는 폐기
+    CancelPendingDeformation();
+    LastSimplifiedTriangleCount = 0;
+    InvalidateMeshStateHash();
+
+    AActor* Owner = GetOwner();
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+
+    if (IsValid(MeshComp) && IsValid(MeshComp->GetDynamicMesh()))
+    {
+        FGeometryScriptCopyMeshFromAssetOptions AssetOptions;
+        AssetOptions.bApplyBuildSettings = true;
+
+        // [최적화] 헤드리스 서버는 렌더 메쉬 대신 저해상도 충돌 프록시만 들고 변형 (해시/커널/청크/쿠킹 모두 프록시 크기)
+        if (IsHeadless() && HasCollisionProxy())
+        {
+            if (TSharedPtr<const UE::Geometry::FDynamicMesh3> ProxyBase = FindCollisionProxyBase())
+            {
+                MeshComp->GetDynamicMesh()->EditMesh([&ProxyBase](UE::Geometry::FDynamicMesh3& EditMesh)
+                {
+                    EditMesh.Copy(*ProxyBase);
+                }, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+
+                DisplacementLayer.CaptureRestPose(ProxyBase);
+
+                ReleaseDeformationState(MeshComp);
+                MeshComp->NotifyMeshUpdated();
+                return;
+            }
+        }
+
+        // [최적화] 같은 에셋은 변환/법선/탄젠트 계산을 한 번만 하고, 이후엔 캐시에서 복사만 합니다.
+        if (UMDF_BaseMeshCache* Cache = UMDF_BaseMeshCache::Get())
+        {
+            if (TSharedPtr<const UE::Geometry::FDynamicMesh3> BaseMesh = Cache->FindOrBuild(SourceStaticMesh, AssetOptions, FGeometryScriptMeshReadLOD()))
+            {
+                const bool bHeadless = IsHeadless();
+                MeshComp->GetDynamicMesh()->EditMesh([&BaseMesh, bHeadless](UE::Geometry::FDynamicMesh3& EditMesh)
+                {
+                    EditMesh.Copy(*BaseMesh);
+                    if (bHeadless)
+                    {
+                        FMDFMeshAttributeUtils::StripRenderAttributes(EditMesh);
+                    }
+                }, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+
+                // 캐시 메쉬는 변경되지 않으므로 기준 자세로 그대로 공유 (컴포넌트마다 스냅샷을 따로 두지 않음)
+                DisplacementLayer.CaptureRestPose(BaseMesh);
+
+                ResetCollisionProxy(MeshComp);
+                ReleaseDeformationState(MeshComp);
+                MeshComp->NotifyMeshUpdated();
+                return;
+            }
+        }
+
+        EGeometryScriptOutcomePins Outcome;
+
+        // 복사 실행
+        UGeometryScriptLibrary_StaticMeshFunctions::CopyMeshFromStaticMesh(
+            SourceStaticMesh, MeshComp->GetDynamicMesh(), AssetOptions, FGeometryScriptMeshReadLOD(), Outcome
+        );
+
+        if (Outcome == EGeometryScriptOutcomePins::Success)
+        {
+            // [최적화] 이후 배치는 수정 영역만 다시 계산하므로, 여기서 한 번 같은 루틴으로 기준 법선/탄젠트를 맞춰 둡니다.
+            // (에셋에서 가져온 값과 섞이면 변형 영역 경계에 이음새가 생김)
+            const bool bHeadless = IsHeadless();
+            MeshComp->GetDynamicMesh()->EditMesh([bHeadless](UE::Geometry::FDynamicMesh3& EditMesh)
+            {
+                // [최적화] 헤드리스 서버는 렌더 속성을 계산하지 않고 버림 (스냅샷도 위치만 담김)
+                if (bHeadless)
+                {
+                    FMDFMeshAttributeUtils::StripRenderAttributes(EditMesh);
+                    return;
+                }
+
+                // 1. 법선 재계산
+                FMDFMeshAttributeUtils::RecomputeNormals(EditMesh);
+
+                // -------------------------------------------------------------------------
+                // [★핵심 추가] 초기화 시 탄젠트 재계산
+                // 처음 생성될 때부터 메쉬가 투명하게 보이지 않도록 합니다.
+                // -------------------------------------------------------------------------
+                FMDFMeshAttributeUtils::RecomputeTangents(EditMesh);
+            }, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+            
+            // [최적화] 기준 자세 스냅샷 (이후 수리는 여기서 변위만 되돌림)
+            MeshComp->GetDynamicMesh()->ProcessMesh([this](const UE::Geometry::FDynamicMesh3& ReadMesh)
+            {
+                DisplacementLayer.CaptureRestPose(ReadMesh);
+            });
+
+            ResetCollisionProxy(MeshComp);
+            ReleaseDeformationState(MeshComp);
+            MeshComp->NotifyMeshUpdated();
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// [최적화] 피해 전 스태틱 메쉬 대리 표시
+// -----------------------------------------------------------------------------
+bool UMDF_DeformableComponent::IsHeadless() const
+{
+    return CVarMDFServerHeadless.GetValueOnGameThread() != 0 && GetNetMode() == NM_DedicatedServer;
+}
+
+bool UMDF_DeformableComponent::ShouldStartAsStaticProxy() const
+{
+    const UWorld* World = GetWorld();
+    return bUseStaticMeshUntilDamaged && IsValid(SourceStaticMesh) && World && World->IsGameWorld() && HitHistory.IsEmpty();
+}
+
+void UMDF_DeformableComponent::EnterStaticProxy(UDynamicMeshComponent* MeshComp)
+{
+    if (!IsValid(MeshComp) || bUsingStaticProxy) return;
+
+    const ECollisionEnabled::Type CollisionEnabled = MeshComp->GetCollisionEnabled();
+    bool bProxyCreated = false;
+
+    if (bBatchStaticProxies)
+    {
+        if (UMDF_InstancedProxySubsystem* Proxies = UMDF_InstancedProxySubsystem::Get(this))
+        {
+            bProxyCreated = Proxies->AddInstance(this, SourceStaticMesh, MeshComp->GetComponentTransform(), MeshComp, CollisionEnabled);
+        }
+    }
+
+    if (!bProxyCreated)
+    {
+        StaticProxyComponent = CreateStaticProxyComponent(MeshComp, SourceStaticMesh, CollisionEnabled);
+    }
+
+    // 다이나믹 메쉬는 비워서 숨김 (레벨에 저장된/에디터 프리뷰 메쉬 메모리도 반환)
+    HideDynamicMesh(MeshComp, CollisionEnabled);
+
+    DisplacementLayer.Reset();
+    bUsingStaticProxy = true;
+}
+
+UStaticMeshComponent* UMDF_DeformableComponent::CreateStaticProxyComponent(UDynamicMeshComponent* MeshComp, UStaticMesh* StaticMesh, ECollisionEnabled::Type CollisionEnabled)
+{
+    UStaticMeshComponent* Proxy = NewObject<UStaticMeshComponent>(GetOwner(), NAME_None, RF_Transient);
+    Proxy->SetMobility(MeshComp->Mobility);
+    Proxy->SetupAttachment(MeshComp);
+    Proxy->SetStaticMesh(StaticMesh);
+
+    for (int32 Index = 0; Index < MeshComp->GetNumMaterials(); ++Index)
+    {
+        Proxy->SetMaterial(Index, MeshComp->GetMaterial(Index));
+    }
+
+    // 충돌 설정 이어받기 (같은 액터 소속이므로 데미지는 그대로 HandlePointDamage로 들어옴)
+    Proxy->SetCollisionProfileName(MeshComp->GetCollisionProfileName());
+    Proxy->SetCollisionObjectType(MeshComp->GetCollisionObjectType());
+    Proxy->SetCollisionResponseToChannels(MeshComp->GetCollisionResponseToChannels());
+    Proxy->SetCollisionEnabled(CollisionEnabled);
+    Proxy->SetGenerateOverlapEvents(MeshComp->GetGenerateOverlapEvents());
+    Proxy->SetCanEverAffectNavigation(MeshComp->CanEverAffectNavigation());
+
+    Proxy->RegisterComponent();
+    return Proxy;
+}
+
+void UMDF_DeformableComponent::HideDynamicMesh(UDynamicMeshComponent* MeshComp, ECollisionEnabled::Type CollisionEnabled)
+{
+    ProxySavedCollision = CollisionEnabled;
+    MeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    MeshComp->SetVisibility(false);
+    MeshComp->GetDynamicMesh()->Reset();
+    MeshComp->NotifyMeshUpdated();
+
+    VertexHash.Reset();
+    BackBufferMesh.Reset();
+    bDeformationStateMaterialized = false;
+    InvalidateMeshStateHash();
+}
+
+FBox UMDF_DeformableComponent::GetLocalMeshBounds() const
+{
+    if (bUsingStaticProxy && IsValid(SourceStaticMesh))
+    {
+        return SourceStaticMesh->GetBoundingBox();
+    }
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp) || !IsValid(MeshComp->GetDynamicMesh())) return FBox(ForceInit);
+
+    FBox Bounds(ForceInit);
+    MeshComp->GetDynamicMesh()->ProcessMesh([&Bounds](const UE::Geometry::FDynamicMesh3& ReadMesh)
+    {
+        Bounds = FBox(ReadMesh.GetBounds(true));
+    });
+    return Bounds;
+}
+
+void UMDF_DeformableComponent::RemoveStaticProxy()
+{
+    if (UMDF_InstancedProxySubsystem* Proxies = UMDF_InstancedProxySubsystem::Get(this))
+    {
+        Proxies->RemoveInstance(this);
+    }
+
+    if (IsValid(StaticProxyComponent))
+    {
+        StaticProxyComponent->DestroyComponent();
+    }
+    StaticProxyComponent = nullptr;
+}
+
+void UMDF_DeformableComponent::EnsureDynamicMesh()
+{
+    if (!bUsingStaticProxy) return;
+    bUsingStaticProxy = false;
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (IsValid(MeshComp))
+    {
+        MeshComp->SetVisibility(true);
+        MeshComp->SetCollisionEnabled(ProxySavedCollision.Get(ECollisionEnabled::QueryAndPhysics));
+
+        // 대리 표시를 걷어내는 순간 충돌 공백이 생기지 않도록 이번 쿠킹은 동기로
+        const bool bWasAsyncCooking = MeshComp->bUseAsyncCooking;
+        MeshComp->bUseAsyncCooking = false;
+        if (bFrozen)
+        {
+            ThawFrozenMesh(MeshComp);
+        }
+        else
+        {
+            InitializeDynamicMesh();
+        }
+        MeshComp->bUseAsyncCooking = bWasAsyncCooking;
+    }
+    ProxySavedCollision.Reset();
+
+    RemoveStaticProxy();
+    FrozenStaticMesh = nullptr;
+    bFrozen = false;
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF] 다이나믹 메쉬로 전환 (%s)"), *GetNameSafe(GetOwner()));
+}
+
+// -----------------------------------------------------------------------------
+// [최적화] 유휴 메쉬 고정 (Settle-to-Static)
+// -----------------------------------------------------------------------------
+void UMDF_DeformableComponent::ArmFreezeTimer()
+{
+    UWorld* World = GetWorld();
+    if (FreezeAfterIdleSeconds <= 0.0f || !World || !World->IsGameWorld()) return;
+
+    // 충돌 바디를 쿠킹 중이던 고정은 메쉬가 바뀌었으므로 버림
+    CancelPendingFreeze();
+
+    // 히트가 올 때마다 다시 걸어서 "마지막 변형 후 N초"를 잽니다.
+    World->GetTimerManager().SetTimer(FreezeTimerHandle, this, &UMDF_DeformableComponent::FreezeDeformedMesh, FreezeAfterIdleSeconds, false);
+}
+
+void UMDF_DeformableComponent::FreezeDeformedMesh()
+{
+    if (bUsingStaticProxy || bFreezePending) return;
+
+    // 아직 처리할 히트가 남았으면 다음으로 미룸
+    if (IsDeformationInProgress() || LastAppliedIndex < HitHistory.Num() || !HitQueue.IsEmpty())
+    {
+        ArmFreezeTimer();
+        return;
+    }
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp) || !IsValid(MeshComp->GetDynamicMesh())) return;
+
+    // 1. 기준 자세 + 변위로 다시 만들 수 있는 메쉬는 렌더 전용 스태틱 메쉬로 굽고 편집용 메쉬를 버림 (헤드리스 서버 제외)
+    // 2. 다시 만들 수 없는 메쉬(절단 등)는 편집 가속 구조만 버림
+    const bool bBake = bBakeFrozenMeshToStatic && !IsHeadless() && DisplacementLayer.CanRestoreSparse();
+    if (!bBake && !bDeformationStateMaterialized) return;
+
+    PendingFrozenStaticMesh = nullptr;
+    if (bBake)
+    {
+        MeshComp->GetDynamicMesh()->ProcessMesh([&](const UE::Geometry::FDynamicMesh3& ReadMesh)
+        {
+            PendingFrozenStaticMesh = FMDFStaticMeshBaker::Bake(this, ReadMesh, MeshComp);
+        });
+        if (!PendingFrozenStaticMesh && !bDeformationStateMaterialized) return;
+    }
+
+    // 지금 충돌을 맡고 있는 쪽의 설정 (청크가 맡고 있으면 넘겨받기 전 원본 설정, 충돌 프록시가 있으면 프록시가 계속 맡음)
+    PendingFreezeCollision = IsValid(CollisionProxyComponent) ? ECollisionEnabled::NoCollision
+        : CollisionChunks.IsEmpty() ? MeshComp->GetCollisionEnabled()
+        : SavedMeshCollisionEnabled.Get(ECollisionEnabled::QueryAndPhysics);
+
+    if (PendingFreezeCollision == ECollisionEnabled::NoCollision)
+    {
+        CompleteFreeze(MeshComp);
+        return;
+    }
+
+    // 3. 충돌은 단순화한 사본 하나로: 단순화는 백그라운드, 쿠킹은 비동기, 준비될 때까지 현재 충돌(청크/원본) 유지
+    bFreezePending = true;
+    const int32 Serial = ++FreezeSerial;
+
+    TSharedPtr<UE::Geometry::FDynamicMesh3> CollisionMesh = MakeShared<UE::Geometry::FDynamicMesh3>();
+    MeshComp->GetDynamicMesh()->ProcessMesh([&CollisionMesh](const UE::Geometry::FDynamicMesh3& ReadMesh)
+    {
+        *CollisionMesh = ReadMesh;
+    });
+
+    const int32 TargetTriangles = FrozenCollisionTriangles;
+    TWeakObjectPtr<UMDF_DeformableComponent> WeakThis(this);
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [CollisionMesh, TargetTriangles, WeakThis, Serial]()
+    {
+        FMDFMeshAttributeUtils::StripRenderAttributes(*CollisionMesh);
+        if (TargetTriangles > 0)
+        {
+            TArray<int32> NoPinnedVertices;
+            FMDFMeshSimplifier::SimplifyToTriangleCount(*CollisionMesh, TargetTriangles, NoPinnedVertices);
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, CollisionMesh]()
+        {
+            if (UMDF_DeformableComponent* This = WeakThis.Get())
+            {
+                This->BeginFrozenCollision(Serial, CollisionMesh);
+            }
+        });
+    });
+}
+
+void UMDF_DeformableComponent::BeginFrozenCollision(int32 Serial, TSharedPtr<UE::Geometry::FDynamicMesh3> CollisionMesh)
+{
+    // 그사이 새 변형/절단으로 폐기된 작업이면 무시
+    if (!bFreezePending || Serial != FreezeSerial) return;
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp))
+    {
+        CancelPendingFreeze();
+        return;
+    }
+
+    if (!IsValid(FrozenCollisionComponent))
+    {
+        FrozenCollisionComponent = CreateCollisionChunk(MeshComp, FIntVector::ZeroValue);
+    }
+    FrozenCollisionComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
-    for (const FMDFHitData& Hit : NewHits)
+    const int32 NumTriangles = CollisionMesh->TriangleCount();
+    FrozenCollisionComponent->GetDynamicMesh()->EditMesh([&CollisionMesh](UE::Geometry::FDynamicMesh3& EditMesh)
     {
-        FVector WorldHitLoc = ComponentTransform.TransformPosition(Hit.LocalLocation);
-        FVector WorldHitDir = ComponentTransform.TransformVector(Hit.LocalDirection);
+        EditMesh = MoveTemp(*CollisionMesh);
+    }, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
 
-        // 나이아가라 파티클 (파편)
-        if (IsValid(DebrisSystem))
+    FrozenCollisionComponent->bUseAsyncCooking = true;
+    FrozenCollisionComponent->UpdateCollision(false);
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF] 유휴 메쉬 고정: 충돌 바디 쿠킹 시작 (%s, 삼각형: %d)"), *GetNameSafe(GetOwner()), NumTriangles);
+
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().SetTimer(FreezeTakeoverTimerHandle, this, &UMDF_DeformableComponent::PollFreezeTakeover, 0.05f, true);
+    }
+    PollFreezeTakeover();
+}
+
+void UMDF_DeformableComponent::PollFreezeTakeover()
+{
+    if (!bFreezePending || !IsValid(FrozenCollisionComponent)) return;
+
+    // 쿠킹 중에 히트가 들어왔으면 구운 메쉬가 낡았으므로 버리고 다시 유휴를 기다림
+    if (IsDeformationInProgress() || LastAppliedIndex < HitHistory.Num() || !HitQueue.IsEmpty())
+    {
+        CancelPendingFreeze();
+        ArmFreezeTimer();
+        return;
+    }
+
+    const UBodySetup* BodySetup = FrozenCollisionComponent->GetBodySetup();
+    if (BodySetup && !BodySetup->bCreatedPhysicsMeshes) return;
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp))
+    {
+        CancelPendingFreeze();
+        return;
+    }
+
+    // 같은 프레임에 새 바디를 켜고 청크/원본 충돌을 끔 (충돌 공백/중복 없음)
+    FrozenCollisionComponent->SetCollisionEnabled(PendingFreezeCollision);
+    CompleteFreeze(MeshComp);
+}
+
+void UMDF_DeformableComponent::CompleteFreeze(UDynamicMeshComponent* MeshComp)
+{
+    bFreezePending = false;
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(FreezeTakeoverTimerHandle);
+    }
+
+    UStaticMesh* Baked = PendingFrozenStaticMesh;
+    PendingFrozenStaticMesh = nullptr;
+
+    if (Baked)
+    {
+        // 청크가 넘겨받았던 충돌 설정을 원래대로 돌려받은 뒤 대리 표시로 넘김 (대리 표시는 렌더 전용, 충돌은 고정용 바디)
+        DestroyCollisionChunks(MeshComp);
+        const ECollisionEnabled::Type CollisionEnabled = MeshComp->GetCollisionEnabled();
+
+        FrozenStaticMesh = Baked;
+        StaticProxyComponent = CreateStaticProxyComponent(MeshComp, Baked, ECollisionEnabled::NoCollision);
+        HideDynamicMesh(MeshComp, CollisionEnabled);
+
+        bFrozen = true;
+        bUsingStaticProxy = true;
+
+        UE_LOG(LogTemp, Log, TEXT("[MDF] 유휴 메쉬 고정: 스태틱 메쉬로 굽기 (%s, 변위 버텍스: %d)"), *GetNameSafe(GetOwner()), DisplacementLayer.NumDisplaced());
+        return;
+    }
+
+    // 가속 구조만 버리고, 원본 메쉬는 렌더링만 (다음 변형에서 청크가 다시 넘겨받거나 원본 충돌로 복원)
+    BackBufferMesh.Reset();
+    bDeformationStateMaterialized = false;
+    VertexHash.Reset();
+    DestroyCollisionChunks(MeshComp);
+    if (IsValid(FrozenCollisionComponent))
+    {
+        ProxySavedCollision = MeshComp->GetCollisionEnabled();
+        MeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF] 유휴 메쉬 고정: 가속 구조 해제 (%s)"), *GetNameSafe(GetOwner()));
+}
+
+void UMDF_DeformableComponent::CancelPendingFreeze()
+{
+    if (!bFreezePending) return;
+
+    bFreezePending = false;
+    ++FreezeSerial;
+    PendingFrozenStaticMesh = nullptr;
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(FreezeTakeoverTimerHandle);
+    }
+
+    // 아직 충돌을 넘겨받지 않았으므로 바디만 버림
+    DestroyFrozenCollision(GetTargetMeshComponent());
+}
+
+void UMDF_DeformableComponent::DestroyFrozenCollision(UDynamicMeshComponent* MeshComp)
+{
+    if (!IsValid(FrozenCollisionComponent)) return;
+
+    FrozenCollisionComponent->DestroyComponent();
+    FrozenCollisionComponent = nullptr;
+
+    // 가속 구조만 해제했던 고정이면 원본 메쉬 충돌을 되돌림 (대리 표시 중이면 EnsureDynamicMesh가 되돌림)
+    if (!bUsingStaticProxy && ProxySavedCollision.IsSet() && IsValid(MeshComp))
+    {
+        MeshComp->SetCollisionEnabled(ProxySavedCollision.GetValue());
+        ProxySavedCollision.Reset();
+    }
+}
+
+void UMDF_DeformableComponent::ThawFrozenMesh(UDynamicMeshComponent* MeshComp)
+{
+    // 기준 자세 + 변위로 편집용 메쉬 복원 (에셋 변환 없음, 변위가 있는 영역만 법선/탄젠트 재계산)
+    MeshComp->GetDynamicMesh()->EditMesh([this](UE::Geometry::FDynamicMesh3& EditMesh)
+    {
+        TArray<int32> DisplacedVertices;
+        DisplacementLayer.RebuildMesh(EditMesh, DisplacedVertices);
+        FMDFMeshAttributeUtils::RecomputeNormalsRegion(EditMesh, DisplacedVertices);
+        FMDFMeshAttributeUtils::RecomputeTangentsRegion(EditMesh, DisplacedVertices);
+    }, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+
+    ReleaseDeformationState(MeshComp);
+    MeshComp->NotifyMeshUpdated();
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF] 고정 해제 (%s)"), *GetNameSafe(GetOwner()));
+}
+
+// -----------------------------------------------------------------------------
+// [최적화] 첫 변형 전까지는 개별 상태를 만들지 않음
+// -----------------------------------------------------------------------------
+void UMDF_DeformableComponent::ReleaseDeformationState(UDynamicMeshComponent* MeshComp)
+{
+    bDeformationStateMaterialized = false;
+
+    // 공간 해시는 첫 배치에서 EnsureVertexHash가 만듭니다.
+    VertexHash.Reset();
+
+    // 청크 메쉬(= 메쉬 한 벌 분량의 사본)도 첫 변형까지 미루고, 그동안은 원본 메쉬 충돌 하나로 처리
+    DestroyCollisionChunks(MeshComp);
+    if (!IsValid(CollisionProxyComponent))
+    {
+        MeshComp->UpdateCollision(false);
+    }
+
+    // 원본 메쉬 바디가 다시 만들어졌으므로 고정용 바디는 필요 없음
+    DestroyFrozenCollision(MeshComp);
+}
+
+void UMDF_DeformableComponent::MaterializeDeformationState(UDynamicMeshComponent* MeshComp)
+{
+    if (bDeformationStateMaterialized) return;
+    bDeformationStateMaterialized = true;
+
+    // 청크는 비동기 쿠킹이 끝나 넘겨받을 때 고정용 바디를 내려놓음, 청크가 없으면 원본 메쉬 충돌로 바로 복귀
+    if (ShouldUseCollisionChunks())
+    {
+        RebuildCollisionChunks(MeshComp);
+    }
+    else
+    {
+        DestroyFrozenCollision(MeshComp);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF] 첫 변형: 개별 상태 생성 (%s)"), *GetNameSafe(GetOwner()));
+}
+
+// -----------------------------------------------------------------------------
+// [최적화] 기준 자세 복원 (수리/리셋)
+// -----------------------------------------------------------------------------
+bool UMDF_DeformableComponent::RestoreRestPose()
+{
+    // 아직 스태틱 메쉬로 표시 중이면 되돌릴 것이 없음 (대기 중인 작업만 정리)
+    if (bUsingStaticProxy && !bFrozen)
+    {
+        CancelPendingDeformation();
+        return true;
+    }
+
+    // 고정된 메쉬는 먼저 풀어서 일반 경로로 되돌림
+    EnsureDynamicMesh();
+
+    if (!DisplacementLayer.HasRestPose()) return false;
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp) || !IsValid(MeshComp->GetDynamicMesh())) return false;
+
+    // 진행 중인 작업 결과는 어차피 되돌릴 대상이므로 폐기
+    CancelPendingDeformation();
+    InvalidateMeshStateHash();
+
+    // 가속 구조만 해제한 고정 상태였으면 원본 메쉬 충돌로 복귀 (아래에서 다시 쿠킹)
+    DestroyFrozenCollision(MeshComp);
+
+    // 충돌 프록시는 작으므로 항상 기준 자세 통째로 복사
+    if (IsValid(CollisionProxyComponent))
+    {
+        ResetCollisionProxy(MeshComp);
+    }
+
+    // 한 번도 변형되지 않은 메쉬는 되돌릴 것이 없음
+    if (DisplacementLayer.CanRestoreSparse() && DisplacementLayer.NumDisplaced() == 0) return true;
+
+    if (DisplacementLayer.CanRestoreSparse())
+    {
+        // 변위가 있는 버텍스만 되돌리고, 나머지 갱신은 일반 변형 배치와 같은 경로로
+        FMDFDeformBatch RepairBatch;
+        MeshComp->GetDynamicMesh()->EditMesh([&](UE::Geometry::FDynamicMesh3& EditMesh)
         {
-            UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), DebrisSystem, WorldHitLoc, WorldHitDir.Rotation());
-        }
+            DisplacementLayer.RestoreSparse(EditMesh, RepairBatch);
+        }, EDynamicMeshChangeType::DeformationEdit, DeformationChangeFlags, true);
 
-        // 타격 사운드
-        if (IsValid(ImpactSound))
+        // 고정이 풀린 직후처럼 해시/청크가 없으면 메쉬 전체 충돌 하나만 갱신
+        if (!bDeformationStateMaterialized)
         {
-            UGameplayStatics::PlaySoundAtLocation(GetWorld(), ImpactSound, WorldHitLoc, FRotator::ZeroRotator, 1.0f, 1.0f, 0.0f, ImpactAttenuation);
+            if (!IsValid(CollisionProxyComponent))
+            {
+                MeshComp->UpdateCollision(false);
+            }
+            MeshComp->NotifyMeshUpdated();
+            return true;
         }
+
+        ApplyBatchToVertexHash(RepairBatch);
+        UpdateCollisionForBatch(MeshComp, RepairBatch);
+        NotifyDeformationRenderUpdate(MeshComp, RepairBatch);
+
+        UE_LOG(LogTemp, Log, TEXT("[MDF] 기준 자세 복원 (희소, 버텍스: %d)"), RepairBatch.ModifiedVertices.Num());
+        return true;
     }
+
+    // 절단 등으로 토폴로지가 바뀌었으면 스냅샷 전체 복사 (그래도 에셋 임포트/속성 재계산은 없음)
+    const bool bHeadless = IsHeadless();
+    MeshComp->GetDynamicMesh()->EditMesh([this, bHeadless](UE::Geometry::FDynamicMesh3& EditMesh)
+    {
+        DisplacementLayer.RestoreFull(EditMesh);
+        if (bHeadless)
+        {
+            FMDFMeshAttributeUtils::StripRenderAttributes(EditMesh); // 공유 스냅샷에는 렌더 속성이 있을 수 있음
+        }
+        VertexHash.Build(EditMesh, (double)DeformRadius);
+    }, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+    LastSimplifiedTriangleCount = 0;
+
+    RebuildCollisionChunks(MeshComp);
+    MeshComp->NotifyMeshUpdated();
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF] 기준 자세 복원 (전체 복사)"));
+    return true;
 }
 
 // -----------------------------------------------------------------------------
-// [초기화] 스태틱 메쉬 -> 다이나믹 메쉬 복사
+// [최적화] 커널 입력 변환 (히트별 강도 사전 계산)
 // -----------------------------------------------------------------------------
-void UMDF_DeformableComponent::InitializeDynamicMesh()
+void UMDF_DeformableComponent::BuildKernelHits(int32 BeginIndex, int32 EndIndex, TArray<FMDFKernelHit>& OutHits) const
 {
-    if (!IsValid(SourceStaticMesh)) return;
+    OutHits.Reset(EndIndex - BeginIndex);
 
-    AActor* Owner = GetOwner();
-    UDynamicMeshComponent* MeshComp = IsValid(Owner) ? Owner->FindComponentByClass<UDynamicMeshComponent>() : nullptr;
+    // [수정] 데미지에 따른 강도 조절 - 계수를 0.05 → 0.15로 상향 (프로필이 있으면 프로필 값)
+    const UMDF_DeformationProfile* Profile = DeformationProfile;
+    const float DamageToStrength = Profile ? Profile->DamageToStrength : 0.15f;
 
-    if (IsValid(MeshComp) && IsValid(MeshComp->GetDynamicMesh()))
+    // [최적화] 데미지 타입 가중치는 배치 안에서 타입당 한 번만 해석 (클래스 계층 탐색/IsChildOf를 히트마다 반복하지 않음)
+    // 한 배치에 섞이는 타입은 보통 몇 개뿐이라 선형 탐색 평탄 배열이 맵보다 빠릅니다.
+    TArray<TPair<const UClass*, float>, TInlineAllocator<4>> MultiplierLookup;
+
+    auto ResolveMultiplier = [&](const UClass* DamageTypeClass) -> float
     {
-        FGeometryScriptCopyMeshFromAssetOptions AssetOptions;
-        AssetOptions.bApplyBuildSettings = true;
-        EGeometryScriptOutcomePins Outcome;
+        for (const TPair<const UClass*, float>& Entry : MultiplierLookup)
+        {
+            if (Entry.Key == DamageTypeClass) return Entry.Value;
+        }
 
-        // 복사 실행
-        UGeometryScriptLibrary_StaticMeshFunctions::CopyMeshFromStaticMesh(
-            SourceStaticMesh, MeshComp->GetDynamicMesh(), AssetOptions, FGeometryScriptMeshReadLOD(), Outcome
-        );
+        float Multiplier = 1.0f;
+        if (Profile)
+        {
+            Multiplier = Profile->ResolveDamageTypeMultiplier(DamageTypeClass);
+        }
+        else if (DamageTypeClass)
+        {
+            // 데미지 타입별 가중치 (근접은 더 세게, 원거리는 약하게)
+            if (MeleeDamageType && DamageTypeClass->IsChildOf(MeleeDamageType))
+                Multiplier = 1.5f;
+            else if (RangedDamageType && DamageTypeClass->IsChildOf(RangedDamageType))
+                Multiplier = 0.5f;
+        }
 
-        if (Outcome == EGeometryScriptOutcomePins::Success)
+        MultiplierLookup.Emplace(DamageTypeClass, Multiplier);
+        return Multiplier;
+    };
+
+    for (int32 i = BeginIndex; i < EndIndex; ++i)
+    {
+        const FMDFHitData& Hit = HitHistory[i];
+
+        const float CurrentStrength = DeformStrength * Hit.Damage * DamageToStrength * ResolveMultiplier(Hit.DamageTypeClass.Get());
+
+        FMDFKernelHit& KernelHit = OutHits.AddDefaulted_GetRef();
+        KernelHit.Location = (FVector3d)Hit.LocalLocation;
+        KernelHit.Direction = (FVector3d)Hit.LocalDirection;
+        KernelHit.Strength = (double)CurrentStrength;
+        if (Hit.IsRadial())
         {
-            // 1. 법선 재계산
-            UGeometryScriptLibrary_MeshNormalsFunctions::RecomputeNormals(MeshComp->GetDynamicMesh(), FGeometryScriptCalculateNormalsOptions());
-            
-            // -------------------------------------------------------------------------
-            // [★핵심 추가] 초기화 시 탄젠트 재계산
-            // 처음 생성될 때부터 메쉬가 투명하게 보이지 않도록 합니다.
-            // -------------------------------------------------------------------------
-            UGeometryScriptLibrary_MeshNormalsFunctions::ComputeTangents(MeshComp->GetDynamicMesh(), FGeometryScriptTangentsOptions());
-            
-            MeshComp->UpdateCollision(); 
-            MeshComp->NotifyMeshUpdated();
+            KernelHit.OuterRadius = (double)Hit.OuterRadius;
+            KernelHit.InnerRadius = FMath::Clamp((double)Hit.InnerRadius, 0.0, KernelHit.OuterRadius);
         }
     }
 }
 
+// -----------------------------------------------------------------------------
+// [최적화] 공간 해시 유효성 보장
+// -----------------------------------------------------------------------------
+void UMDF_DeformableComponent::EnsureVertexHash(const UE::Geometry::FDynamicMesh3& Mesh)
+{
+    // 셀 크기는 변형 반경에서 유도 (반경 쿼리 1회 = 최대 3x3x3 셀)
+    const double DesiredCellSize = FMath::Max((double)DeformRadius, 1.0);
+
+    const bool bCellSizeChanged = !FMath::IsNearlyEqual(VertexHash.GetCellSize(), DesiredCellSize);
+    const bool bTopologyChanged = VertexHash.GetNumVertices() != Mesh.VertexCount();
+
+    if (!VertexHash.IsBuilt() || bCellSizeChanged || bTopologyChanged)
+    {
+        VertexHash.Build(Mesh, DesiredCellSize);
+        UE_LOG(LogTemp, Log, TEXT("[MDF] 공간 해시 재생성 (버텍스: %d, 셀 크기: %.1f)"), Mesh.VertexCount(), DesiredCellSize);
+    }
+}
+
 // -----------------------------------------------------------------------------
 // [유틸리티] 좌표 변환 함수
 // -----------------------------------------------------------------------------
 FVector UMDF_DeformableComponent::ConvertWorldToLocal(FVector WorldLocation)
 {
-    UDynamicMeshComponent* MeshComp = nullptr;
-    if (GetOwner()) MeshComp = GetOwner()->FindComponentByClass<UDynamicMeshComponent>();
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
 
     if (IsValid(MeshComp)) return MeshComp->GetComponentTransform().InverseTransformPosition(WorldLocation);
     return IsValid(GetOwner()) ? GetOwner()->GetActorTransform().InverseTransformPosition(WorldLocation) : WorldLocation;
@@ -444,8 +2373,7 @@ FVector UMDF_DeformableComponent::ConvertWorldToLocal(FVector WorldLocation)
 
 FVector UMDF_DeformableComponent::ConvertWorldDirectionToLocal(FVector WorldDirection)
 {
-    UDynamicMeshComponent* MeshComp = nullptr;
-    if (GetOwner()) MeshComp = GetOwner()->FindComponentByClass<UDynamicMeshComponent>();
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
 
     if (IsValid(MeshComp)) return MeshComp->GetComponentTransform().InverseTransformVector(WorldDirection);
     return IsValid(GetOwner()) ? GetOwner()->GetActorTransform().InverseTransformVector(WorldDirection) : WorldDirection;
@@ -470,7 +2398,234 @@ void UMDF_DeformableComponent::RepairMesh()
         if (MDF_GS) MDF_GS->SaveMDFData(ComponentGuid, TArray<FMDFHitData>());
     }
 
-    // 메쉬 리셋
-    InitializeDynamicMesh();
+    // 메쉬 리셋 (기준 자세가 있으면 변위만 되돌림)
+    if (!RestoreRestPose())
+    {
+        InitializeDynamicMesh();
+    }
+
+    // [결정론] 기준 자세 해시를 새로 내보냄 (이전 히트 수의 스탬프와 섞이지 않도록)
+    CommitMeshStateHash(nullptr);
     UE_LOG(LogTemp, Warning, TEXT("[MDF] [Server] 수리 완료! (히스토리 초기화됨)"));
-}
\ No newline at end of file
+}
+
+// -----------------------------------------------------------------------------
+// [결정론] 메쉬 상태 해시 검증
+// -----------------------------------------------------------------------------
+void UMDF_DeformableComponent::OnRep_AuthoritativeMeshState()
+{
+    VerifyMeshState();
+}
+
+bool UMDF_DeformableComponent::CanVerifyMeshState() const
+{
+    // 프록시/세분화/단순화/절단은 서버와 클라이언트의 토폴로지가 달라질 수 있으므로 제외
+    return bDeterministicDeformation && !HasCollisionProxy() && !bUsingStaticProxy && DisplacementLayer.CanRestoreSparse();
+}
+
+void UMDF_DeformableComponent::InvalidateMeshStateHash()
+{
+    bMeshStateHashValid = false;
+    LocalMeshStates.Reset();
+    LastResyncHitCount = INDEX_NONE;
+}
+
+void UMDF_DeformableComponent::CommitMeshStateHash(const FMDFDeformBatch* Batch)
+{
+    if (!CanVerifyMeshState()) return;
+
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp) || !IsValid(MeshComp->GetDynamicMesh())) return;
+
+    // 움직인 버텍스만 빼고 더하기, 해시가 없으면 한 번 전체 순회
+    if (bMeshStateHashValid && Batch)
+    {
+        FMDFMeshStateHash::ApplyBatch(*Batch, MeshStateBuckets);
+    }
+    else
+    {
+        MeshComp->GetDynamicMesh()->ProcessMesh([this](const UE::Geometry::FDynamicMesh3& ReadMesh)
+        {
+            FMDFMeshStateHash::Compute(ReadMesh, MeshStateBuckets);
+        });
+        bMeshStateHashValid = true;
+    }
+
+    FMDFMeshStateStamp Stamp;
+    Stamp.HitCount = LastAppliedIndex;
+    Stamp.Buckets = MeshStateBuckets;
+
+    if (GetOwnerRole() == ROLE_Authority)
+    {
+        AuthoritativeMeshState = MoveTemp(Stamp);
+        return;
+    }
+
+    // 서버 해시가 늦게 와도 비교할 수 있도록 최근 몇 개만 보관
+    constexpr int32 MaxLocalMeshStates = 8;
+    LocalMeshStates.RemoveAll([&Stamp](const FMDFMeshStateStamp& Old) { return Old.HitCount >= Stamp.HitCount; });
+    if (LocalMeshStates.Num() >= MaxLocalMeshStates)
+    {
+        LocalMeshStates.RemoveAt(0);
+    }
+    LocalMeshStates.Add(MoveTemp(Stamp));
+
+    VerifyMeshState();
+}
+
+void UMDF_DeformableComponent::VerifyMeshState()
+{
+    if (GetOwnerRole() == ROLE_Authority || !CanVerifyMeshState()) return;
+
+    // 작업 중이면 완료 시점의 스탬프 커밋에서 다시 비교 (스탬프는 남아 있음)
+    if (IsDeformationInProgress()) return;
+
+    const int32 HitCount = AuthoritativeMeshState.HitCount;
+    if (HitCount == INDEX_NONE || AuthoritativeMeshState.Buckets.Num() != FMDFMeshStateHash::NumBuckets) return;
+
+    // 아직 그 지점까지 적용하지 않았거나, 여러 배치를 한 번에 적용해서 그 지점을 건너뛴 경우 (다음 스탬프에서 비교)
+    const int32 LocalIndex = LocalMeshStates.IndexOfByPredicate([HitCount](const FMDFMeshStateStamp& Stamp) { return Stamp.HitCount == HitCount; });
+    if (LocalIndex == INDEX_NONE) return;
+
+    TArray<int32, TInlineAllocator<FMDFMeshStateHash::NumBuckets>> Mismatched;
+    for (int32 Bucket = 0; Bucket < FMDFMeshStateHash::NumBuckets; ++Bucket)
+    {
+        if (LocalMeshStates[LocalIndex].Buckets[Bucket] != AuthoritativeMeshState.Buckets[Bucket])
+        {
+            Mismatched.Add(Bucket);
+        }
+    }
+
+    // 비교한 지점까지의 스탬프는 더 쓸 일이 없음
+    LocalMeshStates.RemoveAt(0, LocalIndex + 1);
+
+    if (Mismatched.IsEmpty())
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("[MDF Sync] 상태 해시 일치 (히트: %d, 해시: %08x)"), HitCount, FMDFMeshStateHash::Combine(AuthoritativeMeshState.Buckets));
+        return;
+    }
+
+    // 같은 지점에서 다시 어긋나면 커널 밖의 원인(에셋/설정 차이)이므로 반복하지 않음
+    if (HitCount == LastResyncHitCount)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[MDF Sync] 재계산 후에도 상태 해시 불일치 (%s, 히트: %d). 서버와 메쉬/설정이 같은지 확인하세요."), *GetNameSafe(GetOwner()), HitCount);
+        return;
+    }
+    LastResyncHitCount = HitCount;
+
+    UE_LOG(LogTemp, Warning, TEXT("[MDF Sync] 상태 해시 불일치 (히트: %d, 버킷: %d / %d) → 해당 영역만 재계산"), HitCount, Mismatched.Num(), FMDFMeshStateHash::NumBuckets);
+    ResyncMeshStateBuckets(Mismatched);
+}
+
+void UMDF_DeformableComponent::ResyncMeshStateBuckets(TConstArrayView<int32> Buckets)
+{
+    UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
+    if (!IsValid(MeshComp) || !IsValid(MeshComp->GetDynamicMesh())) return;
+
+    // 진행 중인 작업이 없을 때만 호출됨 (VerifyMeshState) → 지금까지 적용한 히스토리 전체가 기준
+    MaterializeDeformationState(MeshComp);
+
+    TBitArray<> BucketMask(false, FMDFMeshStateHash::NumBuckets);
+    for (const int32 Bucket : Buckets)
+    {
+        BucketMask[Bucket] = true;
+    }
+
+    // 히트 하나짜리 배치를 재사용하며 기록 순서대로 적용
+    FMDFDeformBatch Step;
+    Step.bDeterministic = true;
+    Step.Radius = (double)DeformRadius;
+    Step.Falloff = DeformationProfile ? DeformationProfile->MakeFalloffParams() : FMDFFalloffParams();
+    TArray<FMDFKernelHit> ReplayHits;
+    BuildKernelHits(0, LastAppliedIndex, ReplayHits);
+
+    // 실제로 위치가 바뀐 버텍스만 모은 결과 (변위/상태 해시/충돌/렌더 갱신용)
+    FMDFDeformBatch Result;
+    int32 NumReplayedHits = 0;
+    int32 NumReplayedVertices = 0;
+
+    MeshComp->GetDynamicMesh()->EditMesh([&](UE::Geometry::FDynamicMesh3& EditMesh)
+    {
+        EnsureVertexHash(EditMesh);
+
+        // 재계산 전 위치 (처음 움직일 때 한 번만 기록), 공간 해시는 움직일 때마다 따라감
+        TMap<int32, FVector3d> Before;
+        auto TrackMove = [&](int32 VertexID, const FVector3d& OldPos, const FVector3d& NewPos)
+        {
+            Before.FindOrAdd(VertexID, OldPos);
+            VertexHash.UpdateVertex(VertexID, OldPos, NewPos);
+        };
+
+        // 1. 대상 버킷에서 기준 자세를 벗어난 버텍스만 되돌림 (변위가 없는 버텍스는 이미 기준 자세)
+        for (const int32 VertexID : DisplacementLayer.GetDisplacedVertices())
+        {
+            if (!EditMesh.IsVertex(VertexID) || !BucketMask[FMDFMeshStateHash::BucketOf(VertexID)]) continue;
+
+            const FVector3d OldPos = EditMesh.GetVertex(VertexID);
+            const FVector3d RestPos = DisplacementLayer.GetRestPosition(VertexID);
+            EditMesh.SetVertex(VertexID, RestPos);
+            TrackMove(VertexID, OldPos, RestPos);
+        }
+
+        // 2. 히트마다 현재 위치 기준 도달 거리 안의 대상 버킷 버텍스만 모아 적용
+        const double Padding = FMDFDeformationKernel::GetDeterministicGatherPadding();
+        Step.Hits.SetNum(1);
+        TArray<int32> Gathered;
+        for (const FMDFKernelHit& Hit : ReplayHits)
+        {
+            Gathered.Reset();
+            TSet<FIntVector> VisitedCells;
+            VertexHash.GatherCandidates(Hit.Location, Hit.GetReach(Step.Radius) + Padding, VisitedCells, Gathered);
+
+            Step.Candidates.Reset();
+            for (const int32 VertexID : Gathered)
+            {
+                if (BucketMask[FMDFMeshStateHash::BucketOf(VertexID)])
+                {
+                    Step.Candidates.Add(VertexID);
+                }
+            }
+            if (Step.Candidates.IsEmpty()) continue;
+
+            Step.Hits[0] = Hit;
+            FMDFDeformationKernel::ApplyBatch(EditMesh, Step);
+            for (int32 Index = 0; Index < Step.ModifiedVertices.Num(); ++Index)
+            {
+                TrackMove(Step.ModifiedVertices[Index], Step.OldPositions[Index], Step.NewPositions[Index]);
+            }
+
+            ++NumReplayedHits;
+            NumReplayedVertices += Step.Candidates.Num();
+        }
+
+        for (const TPair<int32, FVector3d>& Pair : Before)
+        {
+            const FVector3d After = EditMesh.GetVertex(Pair.Key);
+            if (After == Pair.Value) continue;
+
+            Result.ModifiedVertices.Add(Pair.Key);
+            Result.OldPositions.Add(Pair.Value);
+            Result.NewPositions.Add(After);
+        }
+
+        if (RefineTargetEdgeLength > 0.0f)
+        {
+            VertexHash.NoteMovedVertices(EditMesh, Result.ModifiedVertices);
+        }
+
+        FMDFMeshAttributeUtils::RecomputeNormalsRegion(EditMesh, Result.ModifiedVertices);
+        FMDFMeshAttributeUtils::RecomputeTangentsRegion(EditMesh, Result.ModifiedVertices);
+    }, EDynamicMeshChangeType::DeformationEdit, DeformationChangeFlags, true);
+
+    // 공간 해시는 위에서 이미 갱신됨
+    DisplacementLayer.RecordBatch(Result);
+
+    // 이전 스탬프는 재계산 전 상태이므로 버리고 현재 상태로 다시 남김
+    LocalMeshStates.Reset();
+    CommitMeshStateHash(&Result);
+
+    UpdateCollisionForBatch(MeshComp, Result);
+    NotifyDeformationRenderUpdate(MeshComp, Result);
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF Sync] 부분 재계산 완료 (적용 히트: %d / %d, 버텍스-히트 평가: %d, 바뀐 버텍스: %d)"), NumReplayedHits, ReplayHits.Num(), NumReplayedVertices, Result.ModifiedVertices.Num());
+}
@@ -18,6 +18,16 @@
 #include "GeometryScript/MeshUVFunctions.h"
 #include "GeometryScript/GeometryScriptTypes.h" 
 
+#include "DynamicMesh/DynamicMesh3.h"
+#include "Deformation/MDF_MeshAttributeUtils.h"
+#include "Components/MDF_CollisionChunkComponent.h"
+
+namespace
+{
+    /** 절단 박스 표면에 놓인 버텍스를 찾을 때의 허용 오차 (cm) */
+    constexpr double CutRegionTolerance = 0.5;
+}
+
 UMDF_MiniGameComponent::UMDF_MiniGameComponent()
 {
     PrimaryComponentTick.bCanEverTick = true; 
@@ -63,7 +73,7 @@ void UMDF_MiniGameComponent::HandlePointDamage(AActor* DamagedActor, float Damag
         FVector LocalHitPos = GetLocalLocationFromWorld(HitLocation);
         FVector LocalDir = FVector::ForwardVector;
         
-        UDynamicMeshComponent* MeshComp = GetOwner()->FindComponentByClass<UDynamicMeshComponent>();
+        UDynamicMeshComponent* MeshComp = GetTargetMeshComponent();
         if (IsValid(MeshComp))
         {
             LocalDir = MeshComp->GetComponentTransform().InverseTransformVector(ShotFromDirection);
@@ -88,7 +98,7 @@ void UMDF_MiniGameComponent::HandlePointDamage(AActor* DamagedActor, float Damag
 // -----------------------------------------------------------------------------
 FVector UMDF_MiniGameComponent::GetLocalLocationFromWorld(FVector WorldLoc) const
 {
-    UDynamicMeshComponent* DynComp = GetOwner() ? GetOwner()->FindComponentByClass<UDynamicMeshComponent>() : nullptr;
+    UDynamicMeshComponent* DynComp = GetTargetMeshComponent();
     if (DynComp)
     {
         return DynComp->GetComponentTransform().InverseTransformPosition(WorldLoc);
@@ -108,10 +118,10 @@ void UMDF_MiniGameComponent::StartMarking(FVector WorldLocation)
     LocalStartPoint = GetLocalLocationFromWorld(WorldLocation);
 
     // [디버그] 메쉬 바운드 확인
-    UDynamicMeshComponent* DynComp = GetOwner() ? GetOwner()->FindComponentByClass<UDynamicMeshComponent>() : nullptr;
+    UDynamicMeshComponent* DynComp = GetTargetMeshComponent();
     if (DynComp && DynComp->GetDynamicMesh())
     {
-        FBox MeshBounds = UGeometryScriptLibrary_MeshQueryFunctions::GetMeshBoundingBox(DynComp->GetDynamicMesh());
+        FBox MeshBounds = GetLocalMeshBounds();
         UE_LOG(LogTemp, Warning, TEXT("[MiniGame] 메쉬 바운드 - Min: %s, Max: %s"), *MeshBounds.Min.ToString(), *MeshBounds.Max.ToString());
         UE_LOG(LogTemp, Warning, TEXT("[MiniGame] 메쉬 크기 - X: %.1f, Y: %.1f, Z: %.1f"), 
             MeshBounds.GetSize().X, MeshBounds.GetSize().Y, MeshBounds.GetSize().Z);
@@ -125,10 +135,10 @@ void UMDF_MiniGameComponent::UpdateMarking(FVector WorldLocation)
     if (!bIsMarking) return;
 
     FVector CurrentLocalPos = GetLocalLocationFromWorld(WorldLocation);
-    UDynamicMeshComponent* DynComp = GetOwner() ? GetOwner()->FindComponentByClass<UDynamicMeshComponent>() : nullptr;
+    UDynamicMeshComponent* DynComp = GetTargetMeshComponent();
     if (!DynComp || !DynComp->GetDynamicMesh()) return;
     
-    FBox MeshBounds = UGeometryScriptLibrary_MeshQueryFunctions::GetMeshBoundingBox(DynComp->GetDynamicMesh());
+    FBox MeshBounds = GetLocalMeshBounds();
 
     // -------------------------------------------------------------------------
     // [사각형 드래그 방식] 시작점 ~ 현재점으로 Box 생성
@@ -286,11 +296,24 @@ void UMDF_MiniGameComponent::ApplyVisualMeshCut(int32 Index)
     if (LocallyProcessedIndices.Contains(Index)) return;
     LocallyProcessedIndices.Add(Index);
 
-    UDynamicMeshComponent* DynComp = GetOwner() ? GetOwner()->FindComponentByClass<UDynamicMeshComponent>() : nullptr;
+    UDynamicMeshComponent* DynComp = GetTargetMeshComponent();
     if (!DynComp || !DynComp->GetDynamicMesh()) return;
 
     UDynamicMesh* TargetMesh = DynComp->GetDynamicMesh();
 
+    // [최적화] 스태틱 메쉬로 표시 중이었다면 자를 메쉬부터 준비
+    EnsureDynamicMesh();
+
+    // [비동기/타임 슬라이싱] 진행 중인 변형 작업을 먼저 반영 (작업 중에는 프론트 메쉬 수정 금지)
+    FlushPendingDeformation();
+
+    // [최적화] 불리언 결과는 버텍스 ID가 새로 매겨지므로 손상 버텍스는 위치로 기억해 두었다가 다시 찾음
+    TArray<FVector3d> DamagedPositions;
+    TargetMesh->ProcessMesh([this, &DamagedPositions](const UE::Geometry::FDynamicMesh3& ReadMesh)
+    {
+        DisplacementLayer.CaptureDamagedPositions(ReadMesh, DamagedPositions);
+    });
+
     UDynamicMesh* ToolMesh = NewObject<UDynamicMesh>(this); 
     
     // [핵심] X축 좌/우, Z축 위/아래 방향으로 확장
@@ -317,21 +340,53 @@ void UMDF_MiniGameComponent::ApplyVisualMeshCut(int32 Index)
         TargetMesh, FTransform::Identity, ToolMesh, FTransform::Identity, 
         EGeometryScriptBooleanOperation::Subtract, BoolOptions
     );
-    
-    UGeometryScriptLibrary_MeshNormalsFunctions::RecomputeNormals(TargetMesh, FGeometryScriptCalculateNormalsOptions());
-    
-    FBox MeshBounds = UGeometryScriptLibrary_MeshQueryFunctions::GetMeshBoundingBox(TargetMesh);
-    FTransform BoxTransform = FTransform::Identity;
-    BoxTransform.SetTranslation(MeshBounds.GetCenter());
-    BoxTransform.SetScale3D(MeshBounds.GetSize());
 
-    UGeometryScriptLibrary_MeshUVFunctions::SetMeshUVsFromBoxProjection(TargetMesh, 0, BoxTransform, FGeometryScriptMeshSelection());
-    UGeometryScriptLibrary_MeshNormalsFunctions::ComputeTangents(TargetMesh, FGeometryScriptTangentsOptions());
+    // [최적화] 충돌 프록시도 같은 도구로 절단 (클라이언트 예측 충돌이 서버와 같은 모양이 되도록)
+    if (IsValid(CollisionProxyComponent))
+    {
+        UGeometryScriptLibrary_MeshBooleanFunctions::ApplyMeshBoolean(
+            CollisionProxyComponent->GetDynamicMesh(), FTransform::Identity, ToolMesh, FTransform::Identity,
+            EGeometryScriptBooleanOperation::Subtract, BoolOptions
+        );
+        CollisionProxyComponent->GetDynamicMesh()->EditMesh([](UE::Geometry::FDynamicMesh3& EditMesh)
+        {
+            FMDFMeshAttributeUtils::StripRenderAttributes(EditMesh);
+        }, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+        CollisionProxyComponent->UpdateCollision(false);
+    }
+
+    // [최적화] 토폴로지가 바뀌었으므로 공간 해시는 다음 변형 배치에서 재생성
+    VertexHash.Reset();
+    DisplacementLayer.MarkTopologyChanged(); // [최적화] 다음 수리는 기준 자세 전체 복사
+    InvalidateMeshStateHash();
     
+    const FBox RegionBox = CutBox.ExpandBy(CutRegionTolerance);
+
+    // [최적화] 손상 집합 재구성: 남은 손상 버텍스 + 절단면 (단순화가 잘린 자리를 뭉개지 않도록)
+    TargetMesh->ProcessMesh([this, &DamagedPositions, &RegionBox](const UE::Geometry::FDynamicMesh3& ReadMesh)
+    {
+        DisplacementLayer.RebuildDamagedVertices(ReadMesh, DamagedPositions, RegionBox);
+    });
+
+    if (IsHeadless())
+    {
+        // [최적화] 헤드리스 서버: 불리언이 도구 메쉬에서 가져온 렌더 속성만 버리고 법선/UV/탄젠트 계산은 생략
+        TargetMesh->EditMesh([](UE::Geometry::FDynamicMesh3& EditMesh)
+        {
+            FMDFMeshAttributeUtils::StripRenderAttributes(EditMesh);
+        }, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+    }
+    else
+    {
+        ApplyCutRenderAttributes(TargetMesh, RegionBox);
+    }
+
     DynComp->MarkRenderTransformDirty(); 
     DynComp->NotifyMeshUpdated();        
-    DynComp->UpdateCollision(true);      
+    bDeformationStateMaterialized = true; // [최적화] 첫 절단이면 여기서 청크 전체가 만들어짐
+    RebuildCollisionChunks(DynComp, &RegionBox); // [최적화] 절단 영역에 걸친 충돌 청크만 다시 쿠킹
     DynComp->MarkRenderStateDirty();
+    RequestSimplificationIfOverBudget(); // [최적화] 절단이 쌓여 삼각형 예산을 넘으면 백그라운드 단순화
 
     if (ToolMesh)
     {
@@ -342,6 +397,38 @@ void UMDF_MiniGameComponent::ApplyVisualMeshCut(int32 Index)
         CutXExpansionLeft, CutXExpansionRight, CutZExpansionDown, CutZExpansionUp, Index);
 }
 
+void UMDF_MiniGameComponent::ApplyCutRenderAttributes(UDynamicMesh* TargetMesh, const FBox& RegionBox)
+{
+    // [최적화] 법선은 절단면 주변만 재계산
+    // 불리언 결과는 인덱스가 새로 매겨지므로, 절단 박스 표면/내부에 놓인 버텍스(잘린 경계 + 채운 면)를 수정 영역으로 봅니다.
+    TargetMesh->EditMesh([&RegionBox](UE::Geometry::FDynamicMesh3& EditMesh)
+    {
+        TArray<int32> CutVertices;
+        for (int32 VertexID : EditMesh.VertexIndicesItr())
+        {
+            if (RegionBox.IsInsideOrOn(EditMesh.GetVertex(VertexID)))
+            {
+                CutVertices.Add(VertexID);
+            }
+        }
+
+        FMDFMeshAttributeUtils::RecomputeNormalsRegion(EditMesh, CutVertices);
+    }, EDynamicMeshChangeType::AttributeEdit, EDynamicMeshAttributeChangeFlags::NormalsTangents, true);
+    
+    FBox MeshBounds = UGeometryScriptLibrary_MeshQueryFunctions::GetMeshBoundingBox(TargetMesh);
+    FTransform BoxTransform = FTransform::Identity;
+    BoxTransform.SetTranslation(MeshBounds.GetCenter());
+    BoxTransform.SetScale3D(MeshBounds.GetSize());
+
+    UGeometryScriptLibrary_MeshUVFunctions::SetMeshUVsFromBoxProjection(TargetMesh, 0, BoxTransform, FGeometryScriptMeshSelection());
+
+    // 박스 투영이 메쉬 전체 UV를 다시 쓰므로 탄젠트는 전체 재계산 (변형 배치의 영역 갱신과 같은 루틴)
+    TargetMesh->EditMesh([](UE::Geometry::FDynamicMesh3& EditMesh)
+    {
+        FMDFMeshAttributeUtils::RecomputeTangents(EditMesh);
+    }, EDynamicMeshChangeType::AttributeEdit, EDynamicMeshAttributeChangeFlags::NormalsTangents, true);
+}
+
 // -----------------------------------------------------------------------------
 // [유틸리티]
 // -----------------------------------------------------------------------------
@@ -358,13 +445,13 @@ void UMDF_MiniGameComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-    UDynamicMeshComponent* DynComp = GetOwner() ? GetOwner()->FindComponentByClass<UDynamicMeshComponent>() : nullptr;
+    UDynamicMeshComponent* DynComp = GetTargetMeshComponent();
     if (!DynComp) return;
 
     FTransform CompTrans = DynComp->GetComponentTransform();
     FVector WorldScale = CompTrans.GetScale3D();
     
-    FBox WallBounds = UGeometryScriptLibrary_MeshQueryFunctions::GetMeshBoundingBox(DynComp->GetDynamicMesh());
+    FBox WallBounds = GetLocalMeshBounds();
 
     for (const FWeakSpotData& Spot : WeakSpots)
     {
@@ -0,0 +1,132 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_CollisionChunkLayout.cpp
+
+#include "Deformation/MDF_CollisionChunkLayout.h"
+#include "DynamicMesh/DynamicMesh3.h"
+
+using namespace UE::Geometry;
+
+void FMDFCollisionChunkLayout::Build(const FDynamicMesh3& Mesh, double InChunkSize, int32 MaxChunks)
+{
+    Reset();
+    if (Mesh.TriangleCount() == 0) return;
+
+    ChunkSize = FMath::Max(InChunkSize, 1.0);
+    MaxChunks = FMath::Max(MaxChunks, 1);
+
+    // 셀 수가 상한을 넘지 않을 때까지 셀 크기를 키웁니다. (최대 몇 번이면 수렴)
+    TMap<FIntVector, int32> CellToChunk;
+    for (;;)
+    {
+        CellToChunk.Reset();
+        const double InvChunkSize = 1.0 / ChunkSize;
+
+        for (int32 TriangleID : Mesh.TriangleIndicesItr())
+        {
+            const FVector3d Centroid = Mesh.GetTriCentroid(TriangleID);
+            const FIntVector Cell(
+                FMath::FloorToInt32(Centroid.X * InvChunkSize),
+                FMath::FloorToInt32(Centroid.Y * InvChunkSize),
+                FMath::FloorToInt32(Centroid.Z * InvChunkSize));
+            CellToChunk.FindOrAdd(Cell, CellToChunk.Num());
+        }
+
+        if (CellToChunk.Num() <= MaxChunks) break;
+        ChunkSize *= 2.0;
+    }
+
+    Chunks.SetNum(CellToChunk.Num());
+    for (const TPair<FIntVector, int32>& Pair : CellToChunk)
+    {
+        Chunks[Pair.Value].Cell = Pair.Key;
+    }
+
+    TriangleChunk.Init(INDEX_NONE, Mesh.MaxTriangleID());
+
+    const double InvChunkSize = 1.0 / ChunkSize;
+    for (int32 TriangleID : Mesh.TriangleIndicesItr())
+    {
+        const FVector3d Centroid = Mesh.GetTriCentroid(TriangleID);
+        const FIntVector Cell(
+            FMath::FloorToInt32(Centroid.X * InvChunkSize),
+            FMath::FloorToInt32(Centroid.Y * InvChunkSize),
+            FMath::FloorToInt32(Centroid.Z * InvChunkSize));
+
+        const int32 ChunkIndex = CellToChunk.FindChecked(Cell);
+        FChunk& Chunk = Chunks[ChunkIndex];
+        TriangleChunk[TriangleID] = ChunkIndex;
+        Chunk.Triangles.Add(TriangleID);
+
+        const FIndex3i Tri = Mesh.GetTriangle(TriangleID);
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            if (!Chunk.VertexMap.Contains(Tri[Corner]))
+            {
+                Chunk.VertexMap.Add(Tri[Corner], Chunk.VertexMap.Num());
+                Chunk.Bounds += (FVector)Mesh.GetVertex(Tri[Corner]);
+            }
+        }
+    }
+}
+
+void FMDFCollisionChunkLayout::Reset()
+{
+    ChunkSize = 0.0;
+    Chunks.Reset();
+    TriangleChunk.Reset();
+}
+
+void FMDFCollisionChunkLayout::BuildChunkMesh(const FDynamicMesh3& Mesh, int32 ChunkIndex, FDynamicMesh3& OutMesh) const
+{
+    const FChunk& Chunk = Chunks[ChunkIndex];
+
+    OutMesh.Clear();
+
+    // VertexMap 값은 0부터 연속이므로 그 순서대로 추가하면 청크 버텍스 ID와 일치
+    TArray<int32> LocalToMain;
+    LocalToMain.SetNumUninitialized(Chunk.VertexMap.Num());
+    for (const TPair<int32, int32>& Pair : Chunk.VertexMap)
+    {
+        LocalToMain[Pair.Value] = Pair.Key;
+    }
+    for (int32 MainVertexID : LocalToMain)
+    {
+        OutMesh.AppendVertex(Mesh.GetVertex(MainVertexID));
+    }
+
+    for (int32 TriangleID : Chunk.Triangles)
+    {
+        const FIndex3i Tri = Mesh.GetTriangle(TriangleID);
+        OutMesh.AppendTriangle(Chunk.VertexMap[Tri.A], Chunk.VertexMap[Tri.B], Chunk.VertexMap[Tri.C]);
+    }
+}
+
+void FMDFCollisionChunkLayout::CollectVertexUpdates(const FDynamicMesh3& Mesh, TConstArrayView<int32> ModifiedVertices, TMap<int32, TArray<FVertexUpdate>>& OutUpdates) const
+{
+    OutUpdates.Reset();
+
+    TArray<int32, TInlineAllocator<8>> VertexChunks;
+    for (int32 VertexID : ModifiedVertices)
+    {
+        if (!Mesh.IsVertex(VertexID)) continue;
+
+        // 버텍스가 속한 청크 = 인접 삼각형들의 청크
+        VertexChunks.Reset();
+        Mesh.EnumerateVertexTriangles(VertexID, [&](int32 TriangleID)
+        {
+            if (TriangleChunk.IsValidIndex(TriangleID) && TriangleChunk[TriangleID] != INDEX_NONE)
+            {
+                VertexChunks.AddUnique(TriangleChunk[TriangleID]);
+            }
+        });
+
+        const FVector3d Position = Mesh.GetVertex(VertexID);
+        for (int32 ChunkIndex : VertexChunks)
+        {
+            if (const int32* ChunkVertexID = Chunks[ChunkIndex].VertexMap.Find(VertexID))
+            {
+                OutUpdates.FindOrAdd(ChunkIndex).Add({ *ChunkVertexID, Position });
+            }
+        }
+    }
+}
@@ -0,0 +1,726 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_DeformationKernel.cpp
+
+#include "Deformation/MDF_DeformationKernel.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/VectorRegister.h"
+
+static TAutoConsoleVariable<int32> CVarMDFParallelMinVertices(
+    TEXT("MDF.Deform.ParallelMinVertices"),
+    2048,
+    TEXT("후보 버텍스 수가 이 값 이상일 때만 변형 커널을 병렬(ParallelFor)로 실행합니다. 0 이하면 항상 단일 스레드."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarMDFUseSIMD(
+    TEXT("MDF.Deform.UseSIMD"),
+    1,
+    TEXT("1이면 float SoA + VectorRegister4Float 커널(버텍스 4개 동시 처리)을 사용합니다. 0이면 double 스칼라 커널."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarMDFValidateSIMD(
+    TEXT("MDF.Deform.ValidateSIMD"),
+    0,
+    TEXT("1이면 SIMD 결과를 스칼라 커널과 비교하여 허용 오차를 넘으면 경고 로그를 남깁니다. (디버그 전용, 느림)"),
+    ECVF_Cheat);
+
+namespace MDFKernelPrivate
+{
+    /** 청크당 버텍스 수 (위치 24B + 오프셋 24B 기준 약 48KB, L2에 들어가는 크기) */
+    constexpr int32 ChunkSize = 1024;
+
+    /** SIMD 레인 수 (VectorRegister4Float) */
+    constexpr int32 Lanes = 4;
+
+    /** SIMD/스칼라 결과 비교 허용 오차 (cm) */
+    constexpr double ValidateTolerance = 0.01;
+
+    /**
+     * 배치의 히트를 float SoA로 묶은 것.
+     * 정밀도를 위해 위치는 배치 기준점(Origin) 상대 좌표로 저장합니다.
+     */
+    struct FPackedHits
+    {
+        TArray<float> PosX, PosY, PosZ;
+        TArray<float> DirX, DirY, DirZ;
+        TArray<float> Strength;
+        FVector3d Origin = FVector3d::ZeroVector;
+
+        int32 Num() const { return Strength.Num(); }
+
+        void Build(TConstArrayView<FMDFKernelHit> Hits)
+        {
+            const int32 NumHits = Hits.Num();
+            Origin = NumHits > 0 ? Hits[0].Location : FVector3d::ZeroVector;
+
+            for (TArray<float>* Channel : { &PosX, &PosY, &PosZ, &DirX, &DirY, &DirZ, &Strength })
+            {
+                Channel->SetNumUninitialized(NumHits);
+            }
+
+            for (int32 i = 0; i < NumHits; ++i)
+            {
+                const FVector3d Local = Hits[i].Location - Origin;
+                PosX[i] = (float)Local.X;
+                PosY[i] = (float)Local.Y;
+                PosZ[i] = (float)Local.Z;
+                DirX[i] = (float)Hits[i].Direction.X;
+                DirY[i] = (float)Hits[i].Direction.Y;
+                DirZ[i] = (float)Hits[i].Direction.Z;
+                Strength[i] = (float)Hits[i].Strength;
+            }
+        }
+    };
+
+    // ---------------------------------------------------------------------
+    // 감쇠 곡선 정책 (t = 거리 / 반경, 0..1)
+    // - 모양마다 커널 전체가 따로 인스턴스화되므로 버텍스/히트 루프 안에는 모양 분기가 없습니다.
+    // - 파라미터는 청크 시작 시 한 번 스플랫해 둡니다.
+    // ---------------------------------------------------------------------
+
+    /** 1 - t (기존 방식) */
+    struct FLinearFalloff
+    {
+        explicit FLinearFalloff(const FMDFFalloffParams&) {}
+
+        double Eval(double T) const { return 1.0 - T; }
+        VectorRegister4Float Eval(VectorRegister4Float T) const { return VectorSubtract(VectorOneFloat(), T); }
+    };
+
+    /** s = 1 - t, s^2 (3 - 2s) */
+    struct FSmoothstepFalloff
+    {
+        explicit FSmoothstepFalloff(const FMDFFalloffParams&) {}
+
+        double Eval(double T) const
+        {
+            const double S = 1.0 - T;
+            return S * S * (3.0 - 2.0 * S);
+        }
+
+        VectorRegister4Float Eval(VectorRegister4Float T) const
+        {
+            const VectorRegister4Float S = VectorSubtract(VectorOneFloat(), T);
+            const VectorRegister4Float Cubic = VectorSubtract(VectorSetFloat1(3.0f), VectorMultiply(VectorSetFloat1(2.0f), S));
+            return VectorMultiply(VectorMultiply(S, S), Cubic);
+        }
+    };
+
+    /** exp(-k t^2)를 t = 1에서 0이 되도록 정규화 */
+    struct FGaussianFalloff
+    {
+        double K, Bias, Scale;
+        VectorRegister4Float VNegK, VBias, VScale;
+
+        explicit FGaussianFalloff(const FMDFFalloffParams& Params)
+        {
+            K = Params.GaussianSharpness;
+            Bias = FMath::Exp(-K);
+            Scale = 1.0 / (1.0 - Bias);
+            VNegK = VectorSetFloat1((float)-K);
+            VBias = VectorSetFloat1((float)Bias);
+            VScale = VectorSetFloat1((float)Scale);
+        }
+
+        double Eval(double T) const { return (FMath::Exp(-K * T * T) - Bias) * Scale; }
+
+        VectorRegister4Float Eval(VectorRegister4Float T) const
+        {
+            const VectorRegister4Float G = VectorExp(VectorMultiply(VNegK, VectorMultiply(T, T)));
+            return VectorMultiply(VectorSubtract(G, VBias), VScale);
+        }
+    };
+
+    /** 안쪽은 1 - (t/Inner)^2 로 파이고, 바깥 고리는 -Rim * 4u(1-u) 로 솟아오름 */
+    struct FCraterFalloff
+    {
+        double Inner, InvInner, InvOuter, Rim;
+        VectorRegister4Float VInner, VInvInner, VInvOuter, VNegRim4;
+
+        explicit FCraterFalloff(const FMDFFalloffParams& Params)
+        {
+            Inner = Params.CraterInnerRatio;
+            InvInner = 1.0 / Inner;
+            InvOuter = 1.0 / (1.0 - Inner);
+            Rim = Params.CraterRimHeight;
+            VInner = VectorSetFloat1((float)Inner);
+            VInvInner = VectorSetFloat1((float)InvInner);
+            VInvOuter = VectorSetFloat1((float)InvOuter);
+            VNegRim4 = VectorSetFloat1((float)(-4.0 * Rim));
+        }
+
+        double Eval(double T) const
+        {
+            if (T < Inner)
+            {
+                const double Q = T * InvInner;
+                return 1.0 - Q * Q;
+            }
+            const double U = (T - Inner) * InvOuter;
+            return -4.0 * Rim * U * (1.0 - U);
+        }
+
+        VectorRegister4Float Eval(VectorRegister4Float T) const
+        {
+            const VectorRegister4Float Q = VectorMultiply(T, VInvInner);
+            const VectorRegister4Float Bowl = VectorSubtract(VectorOneFloat(), VectorMultiply(Q, Q));
+
+            const VectorRegister4Float U = VectorMultiply(VectorSubtract(T, VInner), VInvOuter);
+            const VectorRegister4Float Ring = VectorMultiply(VNegRim4, VectorMultiply(U, VectorSubtract(VectorOneFloat(), U)));
+
+            return VectorSelect(VectorCompareLT(T, VInner), Bowl, Ring);
+        }
+    };
+
+    /** 기준 스칼라 경로 (double) */
+    template <typename FalloffPolicy>
+    void ProcessChunkScalar(
+        const UE::Geometry::FDynamicMesh3& Mesh, TConstArrayView<int32> Candidates, TConstArrayView<FMDFKernelHit> Hits,
+        const FalloffPolicy& Policy, double RadiusSq, double InverseRadius, int32 Begin, int32 End,
+        TArray<FVector3d>& OutOffsets, TArray<uint8>& OutModified)
+    {
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            const FVector3d VertexPos = Mesh.GetVertex(Candidates[Index]);
+            FVector3d TotalOffset(0.0, 0.0, 0.0);
+            bool bModified = false;
+
+            for (const FMDFKernelHit& Hit : Hits)
+            {
+                const double DistSq = FVector3d::DistSquared(VertexPos, Hit.Location);
+                if (DistSq < RadiusSq)
+                {
+                    const double Falloff = Policy.Eval(FMath::Sqrt(DistSq) * InverseRadius); // 중심일수록 1.0
+                    TotalOffset += Hit.Direction * (Hit.Strength * Falloff);
+                    bModified = true;
+                }
+            }
+
+            OutOffsets[Index] = TotalOffset;
+            OutModified[Index] = bModified ? 1 : 0;
+        }
+    }
+
+    /**
+     * SIMD 경로: 청크의 버텍스 위치를 float SoA로 모은 뒤 4개씩 처리합니다.
+     * 히트 루프가 안쪽이므로 히트 데이터는 브로드캐스트, 버텍스는 레인으로 나뉩니다.
+     */
+    template <typename FalloffPolicy>
+    void ProcessChunkSIMD(
+        const UE::Geometry::FDynamicMesh3& Mesh, TConstArrayView<int32> Candidates, const FPackedHits& Packed,
+        const FalloffPolicy& Policy, float RadiusSq, float InverseRadius, int32 Begin, int32 End,
+        TArray<FVector3d>& OutOffsets, TArray<uint8>& OutModified)
+    {
+        // 청크 크기만큼의 SoA 미러 (스택). 꼬리는 반경 밖 먼 좌표로 채워 마스크에서 자동 탈락
+        alignas(16) float VX[ChunkSize];
+        alignas(16) float VY[ChunkSize];
+        alignas(16) float VZ[ChunkSize];
+        alignas(16) float OX[ChunkSize];
+        alignas(16) float OY[ChunkSize];
+        alignas(16) float OZ[ChunkSize];
+
+        const int32 Count = End - Begin;
+        const int32 PaddedCount = Align(Count, Lanes);
+
+        for (int32 i = 0; i < Count; ++i)
+        {
+            const FVector3d Local = Mesh.GetVertex(Candidates[Begin + i]) - Packed.Origin;
+            VX[i] = (float)Local.X;
+            VY[i] = (float)Local.Y;
+            VZ[i] = (float)Local.Z;
+        }
+        for (int32 i = Count; i < PaddedCount; ++i)
+        {
+            VX[i] = VY[i] = VZ[i] = 1.0e12f;
+        }
+
+        const VectorRegister4Float VRadiusSq = VectorSetFloat1(RadiusSq);
+        const VectorRegister4Float VInvRadius = VectorSetFloat1(InverseRadius);
+        const VectorRegister4Float VZero = VectorZeroFloat();
+        const int32 NumHits = Packed.Num();
+
+        for (int32 i = 0; i < PaddedCount; i += Lanes)
+        {
+            const VectorRegister4Float PX = VectorLoadAligned(&VX[i]);
+            const VectorRegister4Float PY = VectorLoadAligned(&VY[i]);
+            const VectorRegister4Float PZ = VectorLoadAligned(&VZ[i]);
+
+            VectorRegister4Float AccX = VZero;
+            VectorRegister4Float AccY = VZero;
+            VectorRegister4Float AccZ = VZero;
+            VectorRegister4Float AnyMask = VZero;
+
+            for (int32 h = 0; h < NumHits; ++h)
+            {
+                const VectorRegister4Float DX = VectorSubtract(PX, VectorSetFloat1(Packed.PosX[h]));
+                const VectorRegister4Float DY = VectorSubtract(PY, VectorSetFloat1(Packed.PosY[h]));
+                const VectorRegister4Float DZ = VectorSubtract(PZ, VectorSetFloat1(Packed.PosZ[h]));
+
+                const VectorRegister4Float DistSq = VectorMultiplyAdd(DX, DX, VectorMultiplyAdd(DY, DY, VectorMultiply(DZ, DZ)));
+                const VectorRegister4Float InRadius = VectorCompareLT(DistSq, VRadiusSq);
+
+                // 반경 밖 레인은 MaskBits가 0이므로 4개 모두 밖이면 바로 다음 히트로
+                if (VectorMaskBits(InRadius) == 0) continue;
+
+                const VectorRegister4Float Falloff = Policy.Eval(VectorMultiply(VectorSqrt(DistSq), VInvRadius));
+                const VectorRegister4Float Weight = VectorSelect(InRadius, VectorMultiply(VectorSetFloat1(Packed.Strength[h]), Falloff), VZero);
+
+                AccX = VectorMultiplyAdd(VectorSetFloat1(Packed.DirX[h]), Weight, AccX);
+                AccY = VectorMultiplyAdd(VectorSetFloat1(Packed.DirY[h]), Weight, AccY);
+                AccZ = VectorMultiplyAdd(VectorSetFloat1(Packed.DirZ[h]), Weight, AccZ);
+                AnyMask = VectorBitwiseOr(AnyMask, InRadius);
+            }
+
+            VectorStoreAligned(AccX, &OX[i]);
+            VectorStoreAligned(AccY, &OY[i]);
+            VectorStoreAligned(AccZ, &OZ[i]);
+
+            const int32 MaskBits = VectorMaskBits(AnyMask);
+            for (int32 Lane = 0; Lane < Lanes && i + Lane < Count; ++Lane)
+            {
+                OutModified[Begin + i + Lane] = (MaskBits & (1 << Lane)) ? 1 : 0;
+            }
+        }
+
+        for (int32 i = 0; i < Count; ++i)
+        {
+            OutOffsets[Begin + i] = FVector3d(OX[i], OY[i], OZ[i]);
+        }
+    }
+
+    /**
+     * [범위 피해] 폭발 히트 누적
+     * 버텍스마다 방향(중심 → 버텍스)이 달라 SIMD 브로드캐스트가 맞지 않으므로 청크 처리 뒤 따로 더합니다.
+     * 폭발 하나가 포인트 히트 수십 개를 대신하므로 배치당 히트 수는 보통 한두 개입니다.
+     */
+    template <typename FalloffPolicy>
+    void AccumulateRadialChunk(
+        const UE::Geometry::FDynamicMesh3& Mesh, TConstArrayView<int32> Candidates, TConstArrayView<FMDFKernelHit> RadialHits,
+        const FalloffPolicy& Policy, int32 Begin, int32 End,
+        TArray<FVector3d>& OutOffsets, TArray<uint8>& OutModified)
+    {
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            const FVector3d VertexPos = Mesh.GetVertex(Candidates[Index]);
+            FVector3d TotalOffset(0.0, 0.0, 0.0);
+            bool bModified = false;
+
+            for (const FMDFKernelHit& Hit : RadialHits)
+            {
+                const FVector3d Delta = VertexPos - Hit.Location;
+                const double DistSq = Delta.SquaredLength();
+                if (DistSq >= Hit.OuterRadius * Hit.OuterRadius) continue;
+
+                // 안쪽 반경까지는 감쇠 곡선의 시작값(1)
+                const double Dist = FMath::Sqrt(DistSq);
+                const double Span = FMath::Max(Hit.OuterRadius - Hit.InnerRadius, UE_KINDA_SMALL_NUMBER);
+                const double Falloff = Policy.Eval(FMath::Max(0.0, Dist - Hit.InnerRadius) / Span);
+                const FVector3d Direction = Dist > UE_KINDA_SMALL_NUMBER ? Delta / Dist : Hit.Direction;
+
+                TotalOffset += Direction * (Hit.Strength * Falloff);
+                bModified = true;
+            }
+
+            if (bModified)
+            {
+                OutOffsets[Index] += TotalOffset;
+                OutModified[Index] = 1;
+            }
+        }
+    }
+
+    /** [결정론] 격자 정수로 바꾼 히트 */
+    struct FFixedHit
+    {
+        int64 X, Y, Z;
+        int64 DirX, DirY, DirZ;
+        int64 Strength;
+
+        /** 폭발 히트의 바깥/안쪽 반경 (0이면 포인트 히트) */
+        int64 OuterQ, InnerQ;
+    };
+
+    /**
+     * [결정론] exp(X) (X <= 0)
+     * libm exp는 정확히 반올림되지 않아 MSVC/glibc/Apple 결과가 마지막 비트에서 다를 수 있으므로,
+     * 2^-8로 줄인 뒤 9차 테일러 다항식을 계산하고 8번 제곱합니다. (사칙연산만 사용, 상대 오차 1e-11 수준)
+     */
+    double DeterministicExp(double X)
+    {
+        const double R = X * (1.0 / 256.0);
+        double Term = 1.0;
+        double Sum = 1.0;
+        for (int32 N = 1; N <= 9; ++N)
+        {
+            Term = Term * R / (double)N;
+            Sum = Sum + Term;
+        }
+        for (int32 Square = 0; Square < 8; ++Square)
+        {
+            Sum = Sum * Sum;
+        }
+        return Sum;
+    }
+
+    /** [결정론] FGaussianFalloff와 같은 곡선을 DeterministicExp로 계산 (고정소수점 경로 전용) */
+    struct FDeterministicGaussianFalloff
+    {
+        double K, Bias, Scale;
+
+        explicit FDeterministicGaussianFalloff(const FMDFFalloffParams& Params)
+        {
+            K = Params.GaussianSharpness;
+            Bias = DeterministicExp(-K);
+            Scale = 1.0 / (1.0 - Bias);
+        }
+
+        double Eval(double T) const { return (DeterministicExp(-K * T * T) - Bias) * Scale; }
+    };
+
+    /** 반올림 산술 시프트 (음수도 가장 가까운 정수로) */
+    FORCEINLINE int64 RoundShift(int64 Value, int32 Shift)
+    {
+        return (Value + (int64(1) << (Shift - 1))) >> Shift;
+    }
+
+    /** 고정소수점 경로: 버텍스마다 히트를 순서대로 적용 (버텍스끼리는 독립이라 청크 병렬 가능) */
+    template <typename FalloffPolicy>
+    void ProcessChunkFixedPoint(
+        const UE::Geometry::FDynamicMesh3& Mesh, TConstArrayView<int32> Candidates, TConstArrayView<FFixedHit> Hits,
+        const FalloffPolicy& Policy, int64 RadiusQ, double InverseRadiusQ, int32 Begin, int32 End,
+        TArray<FVector3d>& OutPositions, TArray<uint8>& OutModified)
+    {
+        constexpr int32 AccumulateShift = FMDFFixedPoint::WeightBits + FMDFFixedPoint::DirectionBits;
+        const double WeightOne = (double)(1 << FMDFFixedPoint::WeightBits);
+        const int64 RadiusSqQ = RadiusQ * RadiusQ;
+
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            const FVector3d VertexPos = Mesh.GetVertex(Candidates[Index]);
+            int64 PX = FMDFFixedPoint::Quantize(VertexPos.X);
+            int64 PY = FMDFFixedPoint::Quantize(VertexPos.Y);
+            int64 PZ = FMDFFixedPoint::Quantize(VertexPos.Z);
+            bool bModified = false;
+
+            for (const FFixedHit& Hit : Hits)
+            {
+                const bool bRadial = Hit.OuterQ > 0;
+                const int64 ReachQ = bRadial ? Hit.OuterQ : RadiusQ;
+
+                // 축별로 먼저 걸러서 제곱 합이 int64를 넘지 않도록
+                const int64 DX = PX - Hit.X;
+                const int64 DY = PY - Hit.Y;
+                const int64 DZ = PZ - Hit.Z;
+                if (FMath::Abs(DX) >= ReachQ || FMath::Abs(DY) >= ReachQ || FMath::Abs(DZ) >= ReachQ) continue;
+
+                const int64 DistSq = DX * DX + DY * DY + DZ * DZ;
+                if (DistSq >= (bRadial ? ReachQ * ReachQ : RadiusSqQ)) continue;
+
+                // 정수 → double 변환과 sqrt는 정확히 반올림되므로 플랫폼과 무관
+                const double Dist = FMath::Sqrt((double)DistSq);
+                double T = Dist * InverseRadiusQ;
+                int64 DirX = Hit.DirX;
+                int64 DirY = Hit.DirY;
+                int64 DirZ = Hit.DirZ;
+
+                if (bRadial)
+                {
+                    // [범위 피해] 안쪽 반경까지는 최대, 방향은 중심 → 버텍스 (격자 방향으로 반올림)
+                    T = FMath::Max(0.0, Dist - (double)Hit.InnerQ) / (double)FMath::Max<int64>(Hit.OuterQ - Hit.InnerQ, 1);
+                    if (DistSq > 0)
+                    {
+                        const double DirScale = (double)(1 << FMDFFixedPoint::DirectionBits) / Dist;
+                        DirX = FMath::RoundToInt64((double)DX * DirScale);
+                        DirY = FMath::RoundToInt64((double)DY * DirScale);
+                        DirZ = FMath::RoundToInt64((double)DZ * DirScale);
+                    }
+                }
+
+                const int64 Weight = FMath::RoundToInt64(Policy.Eval(T) * WeightOne);
+                const int64 Scaled = Hit.Strength * Weight;
+
+                PX += RoundShift(Scaled * DirX, AccumulateShift);
+                PY += RoundShift(Scaled * DirY, AccumulateShift);
+                PZ += RoundShift(Scaled * DirZ, AccumulateShift);
+                bModified = true;
+            }
+
+            OutPositions[Index] = FVector3d(FMDFFixedPoint::Dequantize(PX), FMDFFixedPoint::Dequantize(PY), FMDFFixedPoint::Dequantize(PZ));
+            OutModified[Index] = bModified ? 1 : 0;
+        }
+    }
+
+    template <typename FalloffPolicy>
+    void ComputeDeterministicPositionsT(
+        const UE::Geometry::FDynamicMesh3& Mesh,
+        TConstArrayView<int32> Candidates,
+        TConstArrayView<FMDFKernelHit> Hits,
+        double Radius,
+        const FMDFFalloffParams& FalloffParams,
+        TArray<FVector3d>& OutPositions,
+        TArray<uint8>& OutModified)
+    {
+        const int32 NumCandidates = Candidates.Num();
+        OutPositions.SetNumUninitialized(NumCandidates);
+        OutModified.SetNumZeroed(NumCandidates);
+
+        const int64 RadiusQ = FMath::Max<int64>(FMDFFixedPoint::Quantize(Radius), 0);
+        if (NumCandidates == 0 || Hits.IsEmpty())
+        {
+            for (int32 Index = 0; Index < NumCandidates; ++Index)
+            {
+                OutPositions[Index] = Mesh.GetVertex(Candidates[Index]);
+            }
+            return;
+        }
+
+        TArray<FFixedHit> FixedHits;
+        FixedHits.Reserve(Hits.Num());
+        for (const FMDFKernelHit& Hit : Hits)
+        {
+            FFixedHit& Fixed = FixedHits.AddDefaulted_GetRef();
+            Fixed.X = FMDFFixedPoint::Quantize(Hit.Location.X);
+            Fixed.Y = FMDFFixedPoint::Quantize(Hit.Location.Y);
+            Fixed.Z = FMDFFixedPoint::Quantize(Hit.Location.Z);
+            Fixed.DirX = FMDFFixedPoint::QuantizeDirection(Hit.Direction.X);
+            Fixed.DirY = FMDFFixedPoint::QuantizeDirection(Hit.Direction.Y);
+            Fixed.DirZ = FMDFFixedPoint::QuantizeDirection(Hit.Direction.Z);
+            Fixed.Strength = FMDFFixedPoint::Quantize(Hit.Strength);
+            Fixed.OuterQ = Hit.IsRadial() ? FMDFFixedPoint::Quantize(Hit.OuterRadius) : 0;
+            Fixed.InnerQ = Hit.IsRadial() ? FMath::Clamp<int64>(FMDFFixedPoint::Quantize(Hit.InnerRadius), 0, Fixed.OuterQ) : 0;
+        }
+
+        const FalloffPolicy Policy(FalloffParams);
+        const double InverseRadiusQ = RadiusQ > 0 ? 1.0 / (double)RadiusQ : 0.0;
+        const int32 NumChunks = FMath::DivideAndRoundUp(NumCandidates, ChunkSize);
+
+        auto ProcessChunk = [&](int32 ChunkIndex)
+        {
+            const int32 Begin = ChunkIndex * ChunkSize;
+            const int32 End = FMath::Min(Begin + ChunkSize, NumCandidates);
+            ProcessChunkFixedPoint(Mesh, Candidates, FixedHits, Policy, RadiusQ, InverseRadiusQ, Begin, End, OutPositions, OutModified);
+        };
+
+        const int32 MinParallel = CVarMDFParallelMinVertices.GetValueOnAnyThread();
+        const bool bParallel = MinParallel > 0 && NumCandidates >= MinParallel && NumChunks > 1;
+
+        ParallelFor(NumChunks, ProcessChunk, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+    }
+
+    template <typename FalloffPolicy>
+    void ComputeOffsetsT(
+        const UE::Geometry::FDynamicMesh3& Mesh,
+        TConstArrayView<int32> Candidates,
+        TConstArrayView<FMDFKernelHit> Hits,
+        double Radius,
+        const FMDFFalloffParams& FalloffParams,
+        TArray<FVector3d>& OutOffsets,
+        TArray<uint8>& OutModified)
+    {
+        const int32 NumCandidates = Candidates.Num();
+        OutOffsets.SetNumUninitialized(NumCandidates);
+        OutModified.SetNumUninitialized(NumCandidates);
+
+        // [범위 피해] 폭발 히트는 따로 모아 청크마다 한 번 더 누적 (포인트 히트 경로는 그대로)
+        TArray<FMDFKernelHit> PointHits;
+        TArray<FMDFKernelHit, TInlineAllocator<4>> RadialHits;
+        if (Hits.ContainsByPredicate([](const FMDFKernelHit& Hit) { return Hit.IsRadial(); }))
+        {
+            for (const FMDFKernelHit& Hit : Hits)
+            {
+                if (Hit.IsRadial())
+                {
+                    RadialHits.Add(Hit);
+                }
+                else
+                {
+                    PointHits.Add(Hit);
+                }
+            }
+            Hits = PointHits;
+        }
+
+        if (NumCandidates == 0 || (RadialHits.IsEmpty() && (Hits.IsEmpty() || Radius <= 0.0)))
+        {
+            OutOffsets.SetNumZeroed(NumCandidates);
+            OutModified.SetNumZeroed(NumCandidates);
+            return;
+        }
+
+        const double RadiusSq = Radius * Radius;
+        const double InverseRadius = Radius > 0.0 ? 1.0 / Radius : 0.0;
+        const int32 NumChunks = FMath::DivideAndRoundUp(NumCandidates, ChunkSize);
+
+        const bool bUseSIMD = CVarMDFUseSIMD.GetValueOnAnyThread() != 0;
+        const bool bValidate = bUseSIMD && CVarMDFValidateSIMD.GetValueOnAnyThread() != 0;
+
+        const FalloffPolicy Policy(FalloffParams);
+
+        FPackedHits Packed;
+        if (bUseSIMD)
+        {
+            Packed.Build(Hits);
+        }
+
+        // 청크 하나 = 워커 하나의 작업 단위. 출력 구간이 겹치지 않으므로 락이 필요 없음
+        auto ProcessChunk = [&](int32 ChunkIndex)
+        {
+            const int32 Begin = ChunkIndex * ChunkSize;
+            const int32 End = FMath::Min(Begin + ChunkSize, NumCandidates);
+
+            if (!bUseSIMD)
+            {
+                ProcessChunkScalar(Mesh, Candidates, Hits, Policy, RadiusSq, InverseRadius, Begin, End, OutOffsets, OutModified);
+            }
+            else
+            {
+                ProcessChunkSIMD(Mesh, Candidates, Packed, Policy, (float)RadiusSq, (float)InverseRadius, Begin, End, OutOffsets, OutModified);
+            }
+
+            if (bValidate)
+            {
+                TArray<FVector3d> RefOffsets;
+                TArray<uint8> RefModified;
+                RefOffsets.SetNumUninitialized(NumCandidates);
+                RefModified.SetNumUninitialized(NumCandidates);
+                ProcessChunkScalar(Mesh, Candidates, Hits, Policy, RadiusSq, InverseRadius, Begin, End, RefOffsets, RefModified);
+
+                for (int32 Index = Begin; Index < End; ++Index)
+                {
+                    const double Error = FVector3d::Distance(RefOffsets[Index], OutOffsets[Index]);
+                    if (Error > ValidateTolerance)
+                    {
+                        UE_LOG(LogTemp, Warning, TEXT("[MDF Kernel] SIMD 오차 초과! VertexID: %d, 오차: %.4f"), Candidates[Index], Error);
+                    }
+                }
+            }
+
+            if (!RadialHits.IsEmpty())
+            {
+                AccumulateRadialChunk(Mesh, Candidates, RadialHits, Policy, Begin, End, OutOffsets, OutModified);
+            }
+        };
+
+        const int32 MinParallel = CVarMDFParallelMinVertices.GetValueOnAnyThread();
+        const bool bParallel = MinParallel > 0 && NumCandidates >= MinParallel && NumChunks > 1;
+
+        ParallelFor(NumChunks, ProcessChunk, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+    }
+}
+
+void FMDFDeformationKernel::ComputeOffsets(
+    const UE::Geometry::FDynamicMesh3& Mesh,
+    TConstArrayView<int32> Candidates,
+    TConstArrayView<FMDFKernelHit> Hits,
+    double Radius,
+    const FMDFFalloffParams& Falloff,
+    TArray<FVector3d>& OutOffsets,
+    TArray<uint8>& OutModified)
+{
+    using namespace MDFKernelPrivate;
+
+    // 모양 분기는 배치당 한 번만
+    switch (Falloff.Shape)
+    {
+    case EMDFFalloffShape::Smoothstep:
+        ComputeOffsetsT<FSmoothstepFalloff>(Mesh, Candidates, Hits, Radius, Falloff, OutOffsets, OutModified);
+        break;
+    case EMDFFalloffShape::Gaussian:
+        ComputeOffsetsT<FGaussianFalloff>(Mesh, Candidates, Hits, Radius, Falloff, OutOffsets, OutModified);
+        break;
+    case EMDFFalloffShape::Crater:
+        ComputeOffsetsT<FCraterFalloff>(Mesh, Candidates, Hits, Radius, Falloff, OutOffsets, OutModified);
+        break;
+    case EMDFFalloffShape::Linear:
+    default:
+        ComputeOffsetsT<FLinearFalloff>(Mesh, Candidates, Hits, Radius, Falloff, OutOffsets, OutModified);
+        break;
+    }
+}
+
+void FMDFDeformationKernel::ComputeDeterministicPositions(
+    const UE::Geometry::FDynamicMesh3& Mesh,
+    TConstArrayView<int32> Candidates,
+    TConstArrayView<FMDFKernelHit> Hits,
+    double Radius,
+    const FMDFFalloffParams& Falloff,
+    TArray<FVector3d>& OutPositions,
+    TArray<uint8>& OutModified)
+{
+    using namespace MDFKernelPrivate;
+
+    switch (Falloff.Shape)
+    {
+    case EMDFFalloffShape::Smoothstep:
+        ComputeDeterministicPositionsT<FSmoothstepFalloff>(Mesh, Candidates, Hits, Radius, Falloff, OutPositions, OutModified);
+        break;
+    case EMDFFalloffShape::Gaussian:
+        ComputeDeterministicPositionsT<FDeterministicGaussianFalloff>(Mesh, Candidates, Hits, Radius, Falloff, OutPositions, OutModified);
+        break;
+    case EMDFFalloffShape::Crater:
+        ComputeDeterministicPositionsT<FCraterFalloff>(Mesh, Candidates, Hits, Radius, Falloff, OutPositions, OutModified);
+        break;
+    case EMDFFalloffShape::Linear:
+    default:
+        ComputeDeterministicPositionsT<FLinearFalloff>(Mesh, Candidates, Hits, Radius, Falloff, OutPositions, OutModified);
+        break;
+    }
+}
+
+void FMDFDeformationKernel::ApplyBatch(UE::Geometry::FDynamicMesh3& Mesh, FMDFDeformBatch& Batch)
+{
+    Batch.ModifiedVertices.Reset();
+    Batch.OldPositions.Reset();
+    Batch.NewPositions.Reset();
+
+    ApplyBatchRange(Mesh, Batch, 0, Batch.Candidates.Num());
+}
+
+void FMDFDeformationKernel::ApplyBatchRange(UE::Geometry::FDynamicMesh3& Mesh, FMDFDeformBatch& Batch, int32 Begin, int32 End)
+{
+    End = FMath::Min(End, Batch.Candidates.Num());
+    if (Begin >= End) return;
+
+    const TConstArrayView<int32> RangeCandidates = MakeArrayView(Batch.Candidates).Slice(Begin, End - Begin);
+
+    // [결정론] 최종 위치(격자 값)를 그대로 기록 (Old + Offset의 부동소수 오차 없음)
+    if (Batch.bDeterministic)
+    {
+        TArray<FVector3d> Positions;
+        TArray<uint8> ModifiedFlags;
+        ComputeDeterministicPositions(Mesh, RangeCandidates, Batch.Hits, Batch.Radius, Batch.Falloff, Positions, ModifiedFlags);
+
+        for (int32 Index = 0; Index < RangeCandidates.Num(); ++Index)
+        {
+            if (!ModifiedFlags[Index]) continue;
+
+            const int32 VertexID = RangeCandidates[Index];
+            const FVector3d OldPos = Mesh.GetVertex(VertexID);
+            Mesh.SetVertex(VertexID, Positions[Index]);
+
+            Batch.ModifiedVertices.Add(VertexID);
+            Batch.OldPositions.Add(OldPos);
+            Batch.NewPositions.Add(Positions[Index]);
+        }
+        return;
+    }
+
+    TArray<FVector3d> Offsets;
+    TArray<uint8> ModifiedFlags;
+    ComputeOffsets(Mesh, RangeCandidates, Batch.Hits, Batch.Radius, Batch.Falloff, Offsets, ModifiedFlags);
+
+    for (int32 Index = 0; Index < RangeCandidates.Num(); ++Index)
+    {
+        if (!ModifiedFlags[Index]) continue;
+
+        const int32 VertexID = RangeCandidates[Index];
+        const FVector3d OldPos = Mesh.GetVertex(VertexID);
+        const FVector3d NewPos = OldPos + Offsets[Index];
+        Mesh.SetVertex(VertexID, NewPos);
+
+        Batch.ModifiedVertices.Add(VertexID);
+        Batch.OldPositions.Add(OldPos);
+        Batch.NewPositions.Add(NewPos);
+    }
+}
@@ -0,0 +1,29 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_DeformationProfile.cpp
+
+#include "Deformation/MDF_DeformationProfile.h"
+#include "GameFramework/DamageType.h"
+
+float UMDF_DeformationProfile::ResolveDamageTypeMultiplier(const UClass* DamageTypeClass) const
+{
+    for (const UClass* Class = DamageTypeClass; Class; Class = Class->GetSuperClass())
+    {
+        if (const float* Multiplier = DamageTypeMultipliers.Find(const_cast<UClass*>(Class)))
+        {
+            return *Multiplier;
+        }
+
+        if (Class == UDamageType::StaticClass()) break;
+    }
+    return 1.0f;
+}
+
+FMDFFalloffParams UMDF_DeformationProfile::MakeFalloffParams() const
+{
+    FMDFFalloffParams Params;
+    Params.Shape = FalloffShape;
+    Params.GaussianSharpness = FMath::Max(GaussianSharpness, 0.1f);
+    Params.CraterInnerRatio = FMath::Clamp(CraterInnerRatio, 0.05f, 0.95f);
+    Params.CraterRimHeight = FMath::Max(CraterRimHeight, 0.0f);
+    return Params;
+}
@@ -0,0 +1,219 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_DisplacementLayer.cpp
+
+#include "Deformation/MDF_DisplacementLayer.h"
+#include "Deformation/MDF_DeformationKernel.h"
+#include "Deformation/MDF_MeshAttributeUtils.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "DynamicMesh/DynamicMeshAttributeSet.h"
+
+using namespace UE::Geometry;
+
+namespace MDFDisplacementPrivate
+{
+    /** 같은 삼각형의 오버레이 요소 값을 스냅샷에서 복사 (토폴로지가 같으므로 삼각형 ID가 일치) */
+    void CopyTriangleElements(const FDynamicMeshNormalOverlay* Source, FDynamicMeshNormalOverlay* Target, int32 TriangleID)
+    {
+        if (!Source || !Target) return;
+        if (!Source->IsSetTriangle(TriangleID) || !Target->IsSetTriangle(TriangleID)) return;
+
+        const FIndex3i SourceElements = Source->GetTriangle(TriangleID);
+        const FIndex3i TargetElements = Target->GetTriangle(TriangleID);
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            Target->SetElement(TargetElements[Corner], Source->GetElement(SourceElements[Corner]));
+        }
+    }
+}
+
+void FMDFDisplacementLayer::CaptureRestPose(const FDynamicMesh3& Mesh)
+{
+    RestMesh = MakeShared<const FDynamicMesh3>(Mesh);
+    bTopologyMatchesRest = true;
+    ClearDisplacements();
+    DamagedVertices.Reset();
+}
+
+void FMDFDisplacementLayer::CaptureRestPose(TSharedPtr<const FDynamicMesh3> SharedMesh)
+{
+    RestMesh = MoveTemp(SharedMesh);
+    bTopologyMatchesRest = RestMesh.IsValid();
+    ClearDisplacements();
+    DamagedVertices.Reset();
+}
+
+void FMDFDisplacementLayer::Reset()
+{
+    RestMesh.Reset();
+    bTopologyMatchesRest = false;
+    ClearDisplacements();
+    DamagedVertices.Reset();
+}
+
+void FMDFDisplacementLayer::MarkTopologyChanged()
+{
+    // 버텍스 ID가 더 이상 스냅샷과 대응하지 않으므로 변위도 의미가 없음
+    bTopologyMatchesRest = false;
+    ClearDisplacements();
+}
+
+void FMDFDisplacementLayer::ClearDisplacements()
+{
+    SlotOfVertex.Reset();
+    DisplacedVertices.Reset();
+    Displacements.Reset();
+}
+
+void FMDFDisplacementLayer::AddDamagedVertices(TConstArrayView<int32> VertexIDs)
+{
+    DamagedVertices.Append(VertexIDs);
+}
+
+void FMDFDisplacementLayer::SetDamagedVertices(TConstArrayView<int32> VertexIDs)
+{
+    DamagedVertices.Reset();
+    DamagedVertices.Append(VertexIDs);
+}
+
+void FMDFDisplacementLayer::CaptureDamagedPositions(const FDynamicMesh3& Mesh, TArray<FVector3d>& OutPositions) const
+{
+    OutPositions.Reset(DamagedVertices.Num());
+    for (const int32 VertexID : DamagedVertices)
+    {
+        if (Mesh.IsVertex(VertexID))
+        {
+            OutPositions.Add(Mesh.GetVertex(VertexID));
+        }
+    }
+}
+
+void FMDFDisplacementLayer::RebuildDamagedVertices(const FDynamicMesh3& Mesh, TConstArrayView<FVector3d> DamagedPositions, const FBox& Region)
+{
+    // 절단 영역 밖의 버텍스는 불리언이 위치를 그대로 복사하므로 정확히 같은 값으로 찾을 수 있음
+    TSet<FVector3d> Positions;
+    Positions.Append(DamagedPositions);
+
+    DamagedVertices.Reset();
+    for (const int32 VertexID : Mesh.VertexIndicesItr())
+    {
+        const FVector3d Position = Mesh.GetVertex(VertexID);
+        if (Region.IsInsideOrOn(Position) || Positions.Contains(Position))
+        {
+            DamagedVertices.Add(VertexID);
+        }
+    }
+}
+
+void FMDFDisplacementLayer::RecordBatch(const FMDFDeformBatch& Batch)
+{
+    // 손상 표시는 토폴로지와 무관하게 (절단/세분화 후의 변형도 단순화에서 고정되도록)
+    DamagedVertices.Append(Batch.ModifiedVertices);
+
+    if (!CanRestoreSparse()) return;
+
+    for (int32 Index = 0; Index < Batch.ModifiedVertices.Num(); ++Index)
+    {
+        const int32 VertexID = Batch.ModifiedVertices[Index];
+        if (!RestMesh->IsVertex(VertexID)) continue;
+
+        if (VertexID >= SlotOfVertex.Num())
+        {
+            SlotOfVertex.Init(INDEX_NONE, FMath::Max(VertexID + 1, RestMesh->MaxVertexID()));
+            for (int32 Slot = 0; Slot < DisplacedVertices.Num(); ++Slot)
+            {
+                SlotOfVertex[DisplacedVertices[Slot]] = Slot;
+            }
+        }
+
+        int32& Slot = SlotOfVertex[VertexID];
+        if (Slot == INDEX_NONE)
+        {
+            Slot = DisplacedVertices.Add(VertexID);
+            Displacements.AddUninitialized();
+        }
+        Displacements[Slot] = Batch.NewPositions[Index] - RestMesh->GetVertex(VertexID);
+    }
+}
+
+FVector3d FMDFDisplacementLayer::GetDisplacement(int32 VertexID) const
+{
+    if (SlotOfVertex.IsValidIndex(VertexID) && SlotOfVertex[VertexID] != INDEX_NONE)
+    {
+        return Displacements[SlotOfVertex[VertexID]];
+    }
+    return FVector3d::ZeroVector;
+}
+
+FVector3d FMDFDisplacementLayer::GetRestPosition(int32 VertexID) const
+{
+    return RestMesh.IsValid() && RestMesh->IsVertex(VertexID) ? RestMesh->GetVertex(VertexID) : FVector3d::ZeroVector;
+}
+
+void FMDFDisplacementLayer::RestoreSparse(FDynamicMesh3& Mesh, FMDFDeformBatch& OutBatch)
+{
+    using namespace MDFDisplacementPrivate;
+
+    OutBatch.ModifiedVertices.Reset(DisplacedVertices.Num());
+    OutBatch.OldPositions.Reset(DisplacedVertices.Num());
+    OutBatch.NewPositions.Reset(DisplacedVertices.Num());
+
+    if (!CanRestoreSparse() || DisplacedVertices.IsEmpty()) return;
+
+    // 1. 위치: 변위가 있는 버텍스만 기준 위치로
+    for (int32 VertexID : DisplacedVertices)
+    {
+        if (!Mesh.IsVertex(VertexID)) continue;
+
+        const FVector3d OldPos = Mesh.GetVertex(VertexID);
+        const FVector3d RestPos = RestMesh->GetVertex(VertexID);
+        Mesh.SetVertex(VertexID, RestPos);
+
+        OutBatch.ModifiedVertices.Add(VertexID);
+        OutBatch.OldPositions.Add(OldPos);
+        OutBatch.NewPositions.Add(RestPos);
+    }
+
+    // 2. 법선/탄젠트: 변형 배치가 다시 계산했던 것과 같은 영역만 스냅샷 값으로 (재계산 없음)
+    if (FMDFMeshAttributeUtils::HasRenderAttributes(Mesh) && FMDFMeshAttributeUtils::HasRenderAttributes(*RestMesh))
+    {
+        TBitArray<> VertexMask;
+        TArray<int32> Triangles;
+        FMDFMeshAttributeUtils::CollectAttributeRegion(Mesh, OutBatch.ModifiedVertices, VertexMask, Triangles);
+
+        const FDynamicMeshAttributeSet* RestAttributes = RestMesh->Attributes();
+        FDynamicMeshAttributeSet* Attributes = Mesh.Attributes();
+        for (int32 TriangleID : Triangles)
+        {
+            CopyTriangleElements(RestAttributes->PrimaryNormals(), Attributes->PrimaryNormals(), TriangleID);
+            CopyTriangleElements(RestAttributes->PrimaryTangents(), Attributes->PrimaryTangents(), TriangleID);
+            CopyTriangleElements(RestAttributes->PrimaryBiTangents(), Attributes->PrimaryBiTangents(), TriangleID);
+        }
+    }
+
+    ClearDisplacements();
+    DamagedVertices.Reset();
+}
+
+void FMDFDisplacementLayer::RebuildMesh(FDynamicMesh3& Mesh, TArray<int32>& OutDisplacedVertices) const
+{
+    OutDisplacedVertices.Reset();
+    if (!CanRestoreSparse()) return;
+
+    Mesh.Copy(*RestMesh);
+    for (int32 Slot = 0; Slot < DisplacedVertices.Num(); ++Slot)
+    {
+        const int32 VertexID = DisplacedVertices[Slot];
+        Mesh.SetVertex(VertexID, RestMesh->GetVertex(VertexID) + Displacements[Slot]);
+    }
+    OutDisplacedVertices = DisplacedVertices;
+}
+
+void FMDFDisplacementLayer::RestoreFull(FDynamicMesh3& Mesh)
+{
+    if (!HasRestPose()) return;
+
+    Mesh.Copy(*RestMesh);
+    bTopologyMatchesRest = true;
+    ClearDisplacements();
+    DamagedVertices.Reset();
+}
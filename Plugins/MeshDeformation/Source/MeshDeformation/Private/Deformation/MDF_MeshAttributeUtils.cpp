@@ -0,0 +1,308 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_MeshAttributeUtils.cpp
+
+#include "Deformation/MDF_MeshAttributeUtils.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "DynamicMesh/DynamicMeshAttributeSet.h"
+#include "DynamicMesh/MeshNormals.h"
+#include "DynamicMesh/MeshTangents.h"
+#include "Async/ParallelFor.h"
+
+using namespace UE::Geometry;
+
+namespace MDFAttributePrivate
+{
+    /** 수정 비율이 이 값을 넘으면 영역 재계산 대신 전체 재계산 */
+    constexpr double FullRecomputeRatio = 0.5;
+
+    /** 요소 수가 이 값 이상일 때만 병렬 처리 */
+    constexpr int32 ParallelMinElements = 1024;
+
+    /** 전체/영역 공통 탄젠트 옵션 (Geometry Script ComputeTangents FastMikkT 기본값과 동일) */
+    FComputeTangentsOptions MakeTangentOptions()
+    {
+        FComputeTangentsOptions Options;
+        Options.bAngleWeighted = true;
+        Options.bAveraged = true;
+        return Options;
+    }
+
+    /**
+     * Triangles만 담은 작업 메쉬를 만듭니다. (위치 + 주 UV/법선 오버레이, 요소 공유 관계 유지)
+     * 삼각형 꼭짓점 순서를 그대로 두므로 OutSubTriangles[i]의 꼭짓점 j는 Triangles[i]의 꼭짓점 j와 같습니다.
+     */
+    void BuildTangentSubmesh(const FDynamicMesh3& Mesh, TConstArrayView<int32> Triangles, FDynamicMesh3& OutSubmesh, TArray<int32>& OutSubTriangles)
+    {
+        const FDynamicMeshUVOverlay* UVs = Mesh.Attributes()->PrimaryUV();
+        const FDynamicMeshNormalOverlay* Normals = Mesh.Attributes()->PrimaryNormals();
+
+        OutSubmesh.Clear();
+        OutSubmesh.EnableAttributes();
+        FDynamicMeshUVOverlay* SubUVs = OutSubmesh.Attributes()->PrimaryUV();
+        FDynamicMeshNormalOverlay* SubNormals = OutSubmesh.Attributes()->PrimaryNormals();
+
+        TMap<int32, int32> VertexMap;
+        TMap<int32, int32> UVMap;
+        TMap<int32, int32> NormalMap;
+
+        OutSubTriangles.Reset(Triangles.Num());
+        for (int32 TriangleID : Triangles)
+        {
+            const FIndex3i Tri = Mesh.GetTriangle(TriangleID);
+            FIndex3i SubTri;
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const int32* Found = VertexMap.Find(Tri[Corner]);
+                SubTri[Corner] = Found ? *Found : VertexMap.Add(Tri[Corner], OutSubmesh.AppendVertex(Mesh.GetVertex(Tri[Corner])));
+            }
+
+            const int32 SubTriangleID = OutSubmesh.AppendTriangle(SubTri);
+            OutSubTriangles.Add(SubTriangleID);
+            if (SubTriangleID < 0) continue;
+
+            if (UVs->IsSetTriangle(TriangleID))
+            {
+                const FIndex3i Elements = UVs->GetTriangle(TriangleID);
+                FIndex3i SubElements;
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const int32* Found = UVMap.Find(Elements[Corner]);
+                    SubElements[Corner] = Found ? *Found : UVMap.Add(Elements[Corner], SubUVs->AppendElement(UVs->GetElement(Elements[Corner])));
+                }
+                SubUVs->SetTriangle(SubTriangleID, SubElements);
+            }
+
+            if (Normals->IsSetTriangle(TriangleID))
+            {
+                const FIndex3i Elements = Normals->GetTriangle(TriangleID);
+                FIndex3i SubElements;
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const int32* Found = NormalMap.Find(Elements[Corner]);
+                    SubElements[Corner] = Found ? *Found : NormalMap.Add(Elements[Corner], SubNormals->AppendElement(Normals->GetElement(Elements[Corner])));
+                }
+                SubNormals->SetTriangle(SubTriangleID, SubElements);
+            }
+        }
+    }
+}
+
+bool FMDFMeshAttributeUtils::HasRenderAttributes(const FDynamicMesh3& Mesh)
+{
+    return Mesh.HasAttributes() && Mesh.Attributes()->PrimaryNormals() != nullptr;
+}
+
+void FMDFMeshAttributeUtils::StripRenderAttributes(FDynamicMesh3& Mesh)
+{
+    Mesh.DiscardVertexNormals();
+    Mesh.DiscardVertexColors();
+    Mesh.DiscardVertexUVs();
+
+    if (!Mesh.HasAttributes()) return;
+
+    FDynamicMeshAttributeSet* Attributes = Mesh.Attributes();
+    Attributes->SetNumUVLayers(0);
+    Attributes->SetNumNormalLayers(0);
+    Attributes->DisablePrimaryColors();
+}
+
+void FMDFMeshAttributeUtils::RecomputeNormals(FDynamicMesh3& Mesh)
+{
+    if (!HasRenderAttributes(Mesh)) return;
+
+    // 면적 + 각도 가중 (FGeometryScriptCalculateNormalsOptions 기본값)
+    FMeshNormals::QuickRecomputeOverlayNormals(Mesh, false, true, true);
+}
+
+void FMDFMeshAttributeUtils::CollectOneRingTriangles(const FDynamicMesh3& Mesh, TConstArrayView<int32> Vertices, TArray<int32>& OutTriangles)
+{
+    OutTriangles.Reset();
+
+    TBitArray<> Visited(false, Mesh.MaxTriangleID());
+    for (int32 VertexID : Vertices)
+    {
+        if (!Mesh.IsVertex(VertexID)) continue;
+
+        Mesh.EnumerateVertexTriangles(VertexID, [&](int32 TriangleID)
+        {
+            if (!Visited[TriangleID])
+            {
+                Visited[TriangleID] = true;
+                OutTriangles.Add(TriangleID);
+            }
+        });
+    }
+}
+
+void FMDFMeshAttributeUtils::CollectAttributeRegion(const FDynamicMesh3& Mesh, TConstArrayView<int32> ModifiedVertices, TBitArray<>& OutVertexMask, TArray<int32>& OutTriangles)
+{
+    // 1. 면 법선/탄젠트가 바뀌는 삼각형 = 수정된 버텍스의 1-링
+    TArray<int32> ChangedTriangles;
+    CollectOneRingTriangles(Mesh, ModifiedVertices, ChangedTriangles);
+
+    // 2. 그 삼각형의 버텍스가 꼭짓점 속성이 바뀌는 대상
+    OutVertexMask.Init(false, Mesh.MaxVertexID());
+    TArray<int32> TargetVertices;
+    for (int32 TriangleID : ChangedTriangles)
+    {
+        const FIndex3i Tri = Mesh.GetTriangle(TriangleID);
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            if (!OutVertexMask[Tri[Corner]])
+            {
+                OutVertexMask[Tri[Corner]] = true;
+                TargetVertices.Add(Tri[Corner]);
+            }
+        }
+    }
+
+    // 3. 대상 버텍스를 꼭짓점으로 갖는 모든 삼각형 (한 링 바깥 경계 포함)
+    CollectOneRingTriangles(Mesh, TargetVertices, OutTriangles);
+}
+
+void FMDFMeshAttributeUtils::RecomputeNormalsRegion(FDynamicMesh3& Mesh, TConstArrayView<int32> ModifiedVertices)
+{
+    using namespace MDFAttributePrivate;
+
+    if (!Mesh.HasAttributes() || ModifiedVertices.IsEmpty()) return;
+
+    FDynamicMeshNormalOverlay* Normals = Mesh.Attributes()->PrimaryNormals();
+    if (!Normals) return;
+
+    if (ModifiedVertices.Num() > Mesh.VertexCount() * FullRecomputeRatio)
+    {
+        RecomputeNormals(Mesh);
+        return;
+    }
+
+    // 1. 면 법선이 바뀌는 삼각형 = 수정된 버텍스의 1-링
+    TArray<int32> Triangles;
+    CollectOneRingTriangles(Mesh, ModifiedVertices, Triangles);
+
+    // 2. 그 삼각형들이 참조하는 법선 요소 (1-링 바깥쪽 꼭짓점의 요소도 포함)
+    TBitArray<> ElementVisited(false, Normals->MaxElementID());
+    TArray<int32> Elements;
+    for (int32 TriangleID : Triangles)
+    {
+        if (!Normals->IsSetTriangle(TriangleID)) continue;
+
+        const FIndex3i TriElements = Normals->GetTriangle(TriangleID);
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            const int32 ElementID = TriElements[Corner];
+            if (!ElementVisited[ElementID])
+            {
+                ElementVisited[ElementID] = true;
+                Elements.Add(ElementID);
+            }
+        }
+    }
+
+    // 3. 요소별로 자신을 쓰는 삼각형들의 면적+각도 가중 면 법선을 합산
+    // (요소마다 결과 슬롯이 달라서 병렬로 써도 겹치지 않음)
+    const EParallelForFlags Flags = Elements.Num() >= ParallelMinElements ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+    ParallelFor(Elements.Num(), [&Mesh, Normals, &Elements](int32 Index)
+    {
+        const int32 ElementID = Elements[Index];
+        const int32 ParentVertex = Normals->GetParentVertex(ElementID);
+
+        FVector3d Sum = FVector3d::Zero();
+        Mesh.EnumerateVertexTriangles(ParentVertex, [&](int32 TriangleID)
+        {
+            if (!Normals->IsSetTriangle(TriangleID)) return;
+
+            const FIndex3i TriElements = Normals->GetTriangle(TriangleID);
+            const int32 Corner = TriElements.IndexOf(ElementID);
+            if (Corner == IndexConstants::InvalidID) return;
+
+            FVector3d FaceNormal, Centroid;
+            double Area = 0.0;
+            Mesh.GetTriInfo(TriangleID, FaceNormal, Area, Centroid);
+            const FVector3d Angles = Mesh.GetTriInternalAnglesR(TriangleID);
+
+            Sum += FaceNormal * (Area * Angles[Corner]);
+        });
+
+        Normals->SetElement(ElementID, FVector3f(Normalized(Sum)));
+    }, Flags);
+}
+
+void FMDFMeshAttributeUtils::RecomputeTangents(FDynamicMesh3& Mesh)
+{
+    using namespace MDFAttributePrivate;
+
+    if (!Mesh.HasAttributes() || Mesh.Attributes()->NumUVLayers() == 0) return;
+
+    FDynamicMeshAttributeSet* Attributes = Mesh.Attributes();
+    if (!Attributes->HasTangentSpace())
+    {
+        Attributes->EnableTangents();
+    }
+
+    FMeshTangentsf Tangents(&Mesh);
+    Tangents.ComputeTriVertexTangents(Attributes->PrimaryNormals(), Attributes->PrimaryUV(), MakeTangentOptions());
+    Tangents.CopyToOverlays(Mesh);
+}
+
+void FMDFMeshAttributeUtils::RecomputeTangentsRegion(FDynamicMesh3& Mesh, TConstArrayView<int32> ModifiedVertices)
+{
+    using namespace MDFAttributePrivate;
+
+    if (!Mesh.HasAttributes() || Mesh.Attributes()->NumUVLayers() == 0 || ModifiedVertices.IsEmpty()) return;
+
+    FDynamicMeshAttributeSet* Attributes = Mesh.Attributes();
+    if (!Attributes->PrimaryNormals()) return;
+
+    if (!Attributes->HasTangentSpace() || ModifiedVertices.Num() > Mesh.VertexCount() * FullRecomputeRatio)
+    {
+        RecomputeTangents(Mesh);
+        return;
+    }
+
+    TBitArray<> VertexMask;
+    TArray<int32> Triangles;
+    CollectAttributeRegion(Mesh, ModifiedVertices, VertexMask, Triangles);
+
+    // 1. 영역 삼각형만 떼어낸 작업 메쉬에서 전체 재계산과 같은 엔진 루틴 실행
+    // 대상 버텍스는 1-링 삼각형이 모두 들어 있으므로 평균에 참여하는 삼각형이 전체 메쉬와 같음
+    FDynamicMesh3 Submesh;
+    TArray<int32> SubTriangles;
+    BuildTangentSubmesh(Mesh, Triangles, Submesh, SubTriangles);
+
+    FMeshTangentsf SubTangents(&Submesh);
+    SubTangents.ComputeTriVertexTangents(Submesh.Attributes()->PrimaryNormals(), Submesh.Attributes()->PrimaryUV(), MakeTangentOptions());
+
+    // 2. 대상 버텍스 꼭짓점만 반영. 요소 공유 여부와 무관하도록 삼각형마다 새 요소로 교체 (쓰이지 않는 이전 요소는 오버레이가 해제)
+    FDynamicMeshNormalOverlay* Tangents = Attributes->PrimaryTangents();
+    FDynamicMeshNormalOverlay* Bitangents = Attributes->PrimaryBiTangents();
+    for (int32 Index = 0; Index < Triangles.Num(); ++Index)
+    {
+        const int32 TriangleID = Triangles[Index];
+        const int32 SubTriangleID = SubTriangles[Index];
+        if (SubTriangleID < 0) continue;
+
+        const FIndex3i Tri = Mesh.GetTriangle(TriangleID);
+        if (!VertexMask[Tri.A] && !VertexMask[Tri.B] && !VertexMask[Tri.C]) continue;
+
+        const bool bHadTangents = Tangents->IsSetTriangle(TriangleID) && Bitangents->IsSetTriangle(TriangleID);
+        FIndex3i NewTangents;
+        FIndex3i NewBitangents;
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            FVector3f Tangent, Bitangent;
+            if (VertexMask[Tri[Corner]] || !bHadTangents)
+            {
+                SubTangents.GetPerTriangleTangent(SubTriangleID, Corner, Tangent, Bitangent);
+            }
+            else
+            {
+                Tangent = Tangents->GetElement(Tangents->GetTriangle(TriangleID)[Corner]);
+                Bitangent = Bitangents->GetElement(Bitangents->GetTriangle(TriangleID)[Corner]);
+            }
+            NewTangents[Corner] = Tangents->AppendElement(Tangent);
+            NewBitangents[Corner] = Bitangents->AppendElement(Bitangent);
+        }
+        Tangents->SetTriangle(TriangleID, NewTangents);
+        Bitangents->SetTriangle(TriangleID, NewBitangents);
+    }
+}
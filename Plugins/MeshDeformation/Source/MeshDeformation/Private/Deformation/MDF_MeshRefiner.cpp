@@ -0,0 +1,139 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_MeshRefiner.cpp
+
+#include "Deformation/MDF_MeshRefiner.h"
+#include "Deformation/MDF_DeformationKernel.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "DynamicMesh/DynamicMeshAttributeSet.h"
+
+using namespace UE::Geometry;
+
+namespace MDFRefinerPrivate
+{
+    struct FEdgeEntry
+    {
+        int32 EdgeID = IndexConstants::InvalidID;
+        double LengthSq = 0.0;
+    };
+
+    /** 긴 변이 힙의 맨 위로 */
+    struct FLongerEdgeFirst
+    {
+        bool operator()(const FEdgeEntry& A, const FEdgeEntry& B) const
+        {
+            return A.LengthSq > B.LengthSq;
+        }
+    };
+
+    /** 선분 AB와 어떤 타격 구라도 겹치는지 (폭발 히트는 바깥 반경 기준) */
+    bool SegmentTouchesHits(const FVector3d& A, const FVector3d& B, TConstArrayView<FMDFKernelHit> Hits, double Radius)
+    {
+        const FVector3d AB = B - A;
+        const double LengthSq = AB.SquaredLength();
+
+        for (const FMDFKernelHit& Hit : Hits)
+        {
+            const double T = LengthSq > 0.0 ? FMath::Clamp((Hit.Location - A).Dot(AB) / LengthSq, 0.0, 1.0) : 0.0;
+            if (DistanceSquared(Hit.Location, A + AB * T) <= FMath::Square(Hit.GetReach(Radius)))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** 나눌 대상이면 힙에 넣습니다. */
+    void PushIfNeeded(const FDynamicMesh3& Mesh, int32 EdgeID, TConstArrayView<FMDFKernelHit> Hits, double Radius, double TargetSq, TArray<FEdgeEntry>& Heap)
+    {
+        if (!Mesh.IsEdge(EdgeID)) return;
+
+        const FIndex2i EdgeV = Mesh.GetEdgeV(EdgeID);
+        const FVector3d A = Mesh.GetVertex(EdgeV.A);
+        const FVector3d B = Mesh.GetVertex(EdgeV.B);
+
+        // 길이 검사가 먼저: 이미 촘촘한 메쉬의 변은 여기서 바로 걸러집니다.
+        const double LengthSq = DistanceSquared(A, B);
+        if (LengthSq <= TargetSq) return;
+        if (!SegmentTouchesHits(A, B, Hits, Radius)) return;
+
+        Heap.HeapPush(FEdgeEntry{ EdgeID, LengthSq }, FLongerEdgeFirst());
+    }
+}
+
+int32 FMDFMeshRefiner::RefineAroundHits(
+    FDynamicMesh3& Mesh,
+    TConstArrayView<FMDFKernelHit> Hits,
+    TConstArrayView<int32> SeedVertices,
+    double Radius,
+    double TargetEdgeLength,
+    int32 MaxNewVertices,
+    TArray<int32>& OutNewVertices)
+{
+    using namespace MDFRefinerPrivate;
+
+    if (Hits.IsEmpty() || Radius <= 0.0 || TargetEdgeLength <= 0.0 || MaxNewVertices <= 0) return 0;
+
+    const double TargetSq = TargetEdgeLength * TargetEdgeLength;
+    const int32 FirstNewIndex = OutNewVertices.Num();
+
+    // 1. 시드 변 수집 (반경에 걸치는 긴 변)
+    // 저폴리 메쉬는 버텍스가 반경 밖에 있어도 변이 반경을 가로지를 수 있으므로 버텍스가 아니라 붙은 변을 검사합니다.
+    // (두 끝점이 모두 시드인 변은 한 번만)
+    TArray<FEdgeEntry> Heap;
+    TBitArray<> VisitedEdges(false, Mesh.MaxEdgeID());
+    for (const int32 VertexID : SeedVertices)
+    {
+        if (!Mesh.IsVertex(VertexID)) continue;
+
+        for (const int32 EdgeID : Mesh.VtxEdgesItr(VertexID))
+        {
+            if (VisitedEdges[EdgeID]) continue;
+            VisitedEdges[EdgeID] = true;
+
+            PushIfNeeded(Mesh, EdgeID, Hits, Radius, TargetSq, Heap);
+        }
+    }
+
+    // 2. 가장 긴 변부터 이등분 (가는 삼각형이 덜 생김)
+    while (Heap.Num() > 0 && OutNewVertices.Num() - FirstNewIndex < MaxNewVertices)
+    {
+        FEdgeEntry Entry;
+        Heap.HeapPop(Entry, FLongerEdgeFirst(), EAllowShrinking::No);
+
+        // 앞선 분할로 이미 짧아진 변은 새 길이로 다시 들어가 있으므로 오래된 항목은 버림
+        if (!Mesh.IsEdge(Entry.EdgeID)) continue;
+        const FIndex2i EdgeV = Mesh.GetEdgeV(Entry.EdgeID);
+        if (DistanceSquared(Mesh.GetVertex(EdgeV.A), Mesh.GetVertex(EdgeV.B)) < Entry.LengthSq) continue;
+
+        FDynamicMesh3::FEdgeSplitInfo SplitInfo;
+        if (Mesh.SplitEdge(Entry.EdgeID, SplitInfo, 0.5) != EMeshResult::Ok) continue;
+
+        OutNewVertices.Add(SplitInfo.NewVertex);
+
+        // 나뉜 두 반쪽 + 맞은편 꼭짓점으로 이어진 새 변
+        PushIfNeeded(Mesh, SplitInfo.OriginalEdge, Hits, Radius, TargetSq, Heap);
+        PushIfNeeded(Mesh, SplitInfo.NewEdges.A, Hits, Radius, TargetSq, Heap);
+        PushIfNeeded(Mesh, SplitInfo.NewEdges.B, Hits, Radius, TargetSq, Heap);
+        if (SplitInfo.NewEdges.C != IndexConstants::InvalidID)
+        {
+            PushIfNeeded(Mesh, SplitInfo.NewEdges.C, Hits, Radius, TargetSq, Heap);
+        }
+    }
+
+    // 3. 보간된 법선은 길이가 1보다 짧으므로 정규화 (변형 반경 가장자리의 움직이지 않는 버텍스용)
+    if (FDynamicMeshNormalOverlay* Normals = Mesh.HasAttributes() ? Mesh.Attributes()->PrimaryNormals() : nullptr)
+    {
+        TArray<int32> Elements;
+        for (int32 Index = FirstNewIndex; Index < OutNewVertices.Num(); ++Index)
+        {
+            Elements.Reset();
+            Normals->GetVertexElements(OutNewVertices[Index], Elements);
+            for (const int32 ElementID : Elements)
+            {
+                Normals->SetElement(ElementID, Normalized(Normals->GetElement(ElementID)));
+            }
+        }
+    }
+
+    return OutNewVertices.Num() - FirstNewIndex;
+}
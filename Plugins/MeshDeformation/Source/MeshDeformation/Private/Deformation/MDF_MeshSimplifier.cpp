@@ -0,0 +1,70 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_MeshSimplifier.cpp
+
+#include "Deformation/MDF_MeshSimplifier.h"
+#include "Deformation/MDF_MeshAttributeUtils.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "MeshSimplification.h"
+#include "MeshConstraints.h"
+#include "MeshConstraintsUtil.h"
+
+using namespace UE::Geometry;
+
+int32 FMDFMeshSimplifier::SimplifyToTriangleCount(FDynamicMesh3& Mesh, int32 TargetTriangleCount, TArray<int32>& InOutPinnedVertices)
+{
+    if (Mesh.TriangleCount() <= TargetTriangleCount) return Mesh.TriangleCount();
+
+    // 1. 고정 조건: 경계/절단면/이음새는 분할·이동·붕괴 금지
+    FMeshConstraints Constraints;
+    FMeshConstraintsUtil::ConstrainAllBoundariesAndSeams(
+        Constraints, Mesh,
+        EEdgeRefineFlags::FullyConstrained,     // 열린 경계
+        EEdgeRefineFlags::FullyConstrained,     // 폴리그룹 경계 (불리언 절단면)
+        EEdgeRefineFlags::FullyConstrained,     // 머티리얼 경계
+        false, false, false);                   // UV/법선 이음새
+
+    // 이미 없어진 ID는 버림 (압축 매핑 범위 밖일 수 있음)
+    InOutPinnedVertices.RemoveAllSwap([&Mesh](int32 VertexID) { return !Mesh.IsVertex(VertexID); });
+    for (const int32 VertexID : InOutPinnedVertices)
+    {
+        Constraints.SetOrUpdateVertexConstraint(VertexID, FVertexConstraint::FullyConstrained());
+    }
+
+    // 2. 속성(법선/UV)까지 고려한 QEM으로 목표 삼각형 수까지 붕괴 (헤드리스 서버 메쉬는 위치만 보는 QEM)
+    if (FMDFMeshAttributeUtils::HasRenderAttributes(Mesh))
+    {
+        FAttrMeshSimplification Simplifier(&Mesh);
+        Simplifier.SetExternalConstraints(MoveTemp(Constraints));
+        Simplifier.CollapseMode = FAttrMeshSimplification::ESimplificationCollapseModes::MinimalQuadricPositionError;
+        Simplifier.SimplifyToTriangleCount(TargetTriangleCount);
+    }
+    else
+    {
+        FQEMSimplification Simplifier(&Mesh);
+        Simplifier.SetExternalConstraints(MoveTemp(Constraints));
+        Simplifier.CollapseMode = FQEMSimplification::ESimplificationCollapseModes::MinimalQuadricPositionError;
+        Simplifier.SimplifyToTriangleCount(TargetTriangleCount);
+    }
+
+    // 3. 빈 ID 슬롯 제거 (메모리/청크 매핑/렌더 버퍼 모두 실제 크기로), 고정 버텍스는 새 ID로
+    FCompactMaps CompactMaps;
+    Mesh.CompactInPlace(&CompactMaps);
+
+    TArray<int32> PinnedVertices;
+    PinnedVertices.Reserve(InOutPinnedVertices.Num());
+    for (const int32 VertexID : InOutPinnedVertices)
+    {
+        const int32 NewVertexID = CompactMaps.GetVertexMapping(VertexID);
+        if (NewVertexID != IndexConstants::InvalidID)
+        {
+            PinnedVertices.Add(NewVertexID);
+        }
+    }
+    InOutPinnedVertices = MoveTemp(PinnedVertices);
+
+    // 4. 붕괴로 면이 바뀌었으므로 법선/탄젠트 전체 재계산 (탄젠트 오버레이의 꼭짓점별 요소 구성도 복원)
+    FMDFMeshAttributeUtils::RecomputeNormals(Mesh);
+    FMDFMeshAttributeUtils::RecomputeTangents(Mesh);
+
+    return Mesh.TriangleCount();
+}
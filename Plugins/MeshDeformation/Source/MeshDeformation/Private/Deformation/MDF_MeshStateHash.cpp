@@ -0,0 +1,65 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_MeshStateHash.cpp
+
+#include "Deformation/MDF_MeshStateHash.h"
+#include "Deformation/MDF_DeformationKernel.h"
+#include "DynamicMesh/DynamicMesh3.h"
+
+using namespace UE::Geometry;
+
+namespace MDFStateHashPrivate
+{
+    /** SplitMix64 마무리 단계 (비트를 고르게 섞음) */
+    FORCEINLINE uint64 Mix(uint64 Value)
+    {
+        Value ^= Value >> 30;
+        Value *= 0xbf58476d1ce4e5b9ull;
+        Value ^= Value >> 27;
+        Value *= 0x94d049bb133111ebull;
+        Value ^= Value >> 31;
+        return Value;
+    }
+}
+
+uint32 FMDFMeshStateHash::HashVertex(int32 VertexID, const FVector3d& Position)
+{
+    using namespace MDFStateHashPrivate;
+
+    uint64 Hash = Mix((uint64)(uint32)VertexID + 0x9e3779b97f4a7c15ull);
+    Hash = Mix(Hash ^ (uint64)FMDFFixedPoint::Quantize(Position.X));
+    Hash = Mix(Hash ^ (uint64)FMDFFixedPoint::Quantize(Position.Y));
+    Hash = Mix(Hash ^ (uint64)FMDFFixedPoint::Quantize(Position.Z));
+    return (uint32)(Hash >> 32);
+}
+
+void FMDFMeshStateHash::Compute(const FDynamicMesh3& Mesh, TArray<uint32>& OutBuckets)
+{
+    OutBuckets.Init(0, NumBuckets);
+    for (const int32 VertexID : Mesh.VertexIndicesItr())
+    {
+        OutBuckets[BucketOf(VertexID)] += HashVertex(VertexID, Mesh.GetVertex(VertexID));
+    }
+}
+
+void FMDFMeshStateHash::ApplyBatch(const FMDFDeformBatch& Batch, TArray<uint32>& InOutBuckets)
+{
+    if (InOutBuckets.Num() != NumBuckets) return;
+
+    for (int32 Index = 0; Index < Batch.ModifiedVertices.Num(); ++Index)
+    {
+        const int32 VertexID = Batch.ModifiedVertices[Index];
+        uint32& Bucket = InOutBuckets[BucketOf(VertexID)];
+        Bucket -= HashVertex(VertexID, Batch.OldPositions[Index]);
+        Bucket += HashVertex(VertexID, Batch.NewPositions[Index]);
+    }
+}
+
+uint32 FMDFMeshStateHash::Combine(TConstArrayView<uint32> Buckets)
+{
+    uint32 Hash = 0;
+    for (const uint32 Bucket : Buckets)
+    {
+        Hash = HashCombineFast(Hash, Bucket);
+    }
+    return Hash;
+}
@@ -0,0 +1,48 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_StaticMeshBaker.cpp
+
+#include "Deformation/MDF_StaticMeshBaker.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "DynamicMeshToMeshDescription.h"
+#include "StaticMeshAttributes.h"
+#include "MeshDescription.h"
+#include "Engine/StaticMesh.h"
+#include "Components/PrimitiveComponent.h"
+
+UStaticMesh* FMDFStaticMeshBaker::Bake(UObject* Outer, const UE::Geometry::FDynamicMesh3& Mesh, const UPrimitiveComponent* MaterialSource)
+{
+    check(IsInGameThread());
+    if (Mesh.TriangleCount() == 0) return nullptr;
+
+    // 1. FDynamicMesh3 → FMeshDescription (법선/탄젠트는 계산된 값 그대로)
+    FMeshDescription MeshDescription;
+    FStaticMeshAttributes Attributes(MeshDescription);
+    Attributes.Register();
+
+    FDynamicMeshToMeshDescription Converter;
+    Converter.Convert(&Mesh, MeshDescription, true);
+
+    // 2. 렌더 전용 스태틱 메쉬 (빠른 빌드, 충돌 바디 없음)
+    UStaticMesh* Baked = NewObject<UStaticMesh>(Outer, NAME_None, RF_Transient);
+
+    const int32 NumMaterials = FMath::Max(1, IsValid(MaterialSource) ? MaterialSource->GetNumMaterials() : 0);
+    for (int32 Index = 0; Index < NumMaterials; ++Index)
+    {
+        UMaterialInterface* Material = IsValid(MaterialSource) ? MaterialSource->GetMaterial(Index) : nullptr;
+        Baked->GetStaticMaterials().Add(FStaticMaterial(Material));
+    }
+
+    UStaticMesh::FBuildMeshDescriptionsParams Params;
+    Params.bFastBuild = true;
+    Params.bAllowCpuAccess = false;
+    Params.bBuildSimpleCollision = false;
+    Params.bCommitMeshDescription = false;
+
+    if (!Baked->BuildFromMeshDescriptions({ &MeshDescription }, Params))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[MDF Bake] 스태틱 메쉬 굽기 실패 (삼각형: %d)"), Mesh.TriangleCount());
+        return nullptr;
+    }
+
+    return Baked;
+}
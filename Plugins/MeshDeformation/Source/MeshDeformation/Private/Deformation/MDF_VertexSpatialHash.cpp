@@ -0,0 +1,129 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_VertexSpatialHash.cpp
+
+#include "Deformation/MDF_VertexSpatialHash.h"
+#include "DynamicMesh/DynamicMesh3.h"
+
+void FMDFVertexSpatialHash::Build(const UE::Geometry::FDynamicMesh3& Mesh, double InCellSize)
+{
+    Reset();
+
+    CellSize = FMath::Max(InCellSize, 1.0);
+    InvCellSize = 1.0 / CellSize;
+
+    for (int32 VertexID : Mesh.VertexIndicesItr())
+    {
+        InsertVertex(VertexID, Mesh.GetVertex(VertexID));
+    }
+
+    double MaxEdgeLengthSq = 0.0;
+    for (int32 EdgeID : Mesh.EdgeIndicesItr())
+    {
+        const UE::Geometry::FIndex2i EdgeV = Mesh.GetEdgeV(EdgeID);
+        MaxEdgeLengthSq = FMath::Max(MaxEdgeLengthSq, (Mesh.GetVertex(EdgeV.A) - Mesh.GetVertex(EdgeV.B)).SquaredLength());
+    }
+    MaxEdgeLength = FMath::Sqrt(MaxEdgeLengthSq);
+}
+
+void FMDFVertexSpatialHash::Reset()
+{
+    Cells.Reset();
+    CellSize = 0.0;
+    InvCellSize = 0.0;
+    NumVertices = 0;
+    MaxEdgeLength = 0.0;
+}
+
+void FMDFVertexSpatialHash::NoteMovedVertices(const UE::Geometry::FDynamicMesh3& Mesh, TConstArrayView<int32> VertexIDs)
+{
+    if (!IsBuilt()) return;
+
+    double MaxEdgeLengthSq = FMath::Square(MaxEdgeLength);
+    for (const int32 VertexID : VertexIDs)
+    {
+        if (!Mesh.IsVertex(VertexID)) continue;
+
+        const FVector3d Position = Mesh.GetVertex(VertexID);
+        for (const int32 NeighborID : Mesh.VtxVerticesItr(VertexID))
+        {
+            MaxEdgeLengthSq = FMath::Max(MaxEdgeLengthSq, (Position - Mesh.GetVertex(NeighborID)).SquaredLength());
+        }
+    }
+    MaxEdgeLength = FMath::Sqrt(MaxEdgeLengthSq);
+}
+
+FIntVector FMDFVertexSpatialHash::ToCell(const FVector3d& Position) const
+{
+    return FIntVector(
+        FMath::FloorToInt32(Position.X * InvCellSize),
+        FMath::FloorToInt32(Position.Y * InvCellSize),
+        FMath::FloorToInt32(Position.Z * InvCellSize));
+}
+
+void FMDFVertexSpatialHash::InsertVertex(int32 VertexID, const FVector3d& Position)
+{
+    Cells.FindOrAdd(ToCell(Position)).Add(VertexID);
+    NumVertices++;
+}
+
+void FMDFVertexSpatialHash::RemoveVertex(int32 VertexID, const FVector3d& Position)
+{
+    const FIntVector Cell = ToCell(Position);
+    if (TArray<int32>* Bucket = Cells.Find(Cell))
+    {
+        if (Bucket->RemoveSingleSwap(VertexID, EAllowShrinking::No) > 0)
+        {
+            NumVertices--;
+        }
+        if (Bucket->IsEmpty())
+        {
+            Cells.Remove(Cell);
+        }
+    }
+}
+
+void FMDFVertexSpatialHash::UpdateVertex(int32 VertexID, const FVector3d& OldPosition, const FVector3d& NewPosition)
+{
+    // 같은 셀 안에서만 움직였다면 할 일이 없음 (대부분의 경우)
+    if (ToCell(OldPosition) == ToCell(NewPosition)) return;
+
+    RemoveVertex(VertexID, OldPosition);
+    InsertVertex(VertexID, NewPosition);
+}
+
+void FMDFVertexSpatialHash::GatherCandidates(const FVector3d& Center, double Radius, TSet<FIntVector>& VisitedCells, TArray<int32>& OutVertices) const
+{
+    if (!IsBuilt()) return;
+
+    const FIntVector MinCell = ToCell(Center - FVector3d(Radius));
+    const FIntVector MaxCell = ToCell(Center + FVector3d(Radius));
+    const double RadiusSq = Radius * Radius;
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+            {
+                const FIntVector Cell(X, Y, Z);
+
+                // 셀 AABB와 구가 실제로 겹치는지 확인 (모서리 셀 걸러내기)
+                const FVector3d CellMin = FVector3d(Cell.X, Cell.Y, Cell.Z) * CellSize;
+                const FVector3d Closest(
+                    FMath::Clamp(Center.X, CellMin.X, CellMin.X + CellSize),
+                    FMath::Clamp(Center.Y, CellMin.Y, CellMin.Y + CellSize),
+                    FMath::Clamp(Center.Z, CellMin.Z, CellMin.Z + CellSize));
+                if (FVector3d::DistSquared(Closest, Center) > RadiusSq) continue;
+
+                const TArray<int32>* Bucket = Cells.Find(Cell);
+                if (!Bucket) continue;
+
+                bool bAlreadyVisited = false;
+                VisitedCells.Add(Cell, &bAlreadyVisited);
+                if (bAlreadyVisited) continue;
+
+                OutVertices.Append(*Bucket);
+            }
+        }
+    }
+}
@@ -0,0 +1,208 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Subsystem/MDF_BaseMeshCache.cpp
+
+#include "Subsystem/MDF_BaseMeshCache.h"
+#include "Deformation/MDF_MeshAttributeUtils.h"
+#include "Deformation/MDF_MeshSimplifier.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "UDynamicMesh.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+static TAutoConsoleVariable<int32> CVarMDFBaseMeshCacheEnable(
+    TEXT("MDF.BaseMeshCache.Enable"),
+    1,
+    TEXT("1이면 스태틱 메쉬 변환 결과(법선/탄젠트 포함)를 에셋/LOD/옵션별로 캐시해 모든 변형 컴포넌트가 공유합니다."),
+    ECVF_Default);
+
+static FAutoConsoleCommand CCmdMDFBaseMeshCacheClear(
+    TEXT("MDF.BaseMeshCache.Clear"),
+    TEXT("베이스 메쉬 캐시를 비웁니다. (이미 초기화된 컴포넌트에는 영향 없음)"),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        if (UMDF_BaseMeshCache* Cache = UMDF_BaseMeshCache::Get())
+        {
+            Cache->Clear();
+        }
+    }));
+
+void UMDF_BaseMeshCache::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UMDF_BaseMeshCache::HandlePostGarbageCollect);
+
+#if WITH_EDITOR
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &UMDF_BaseMeshCache::HandleObjectPropertyChanged);
+#endif
+}
+
+void UMDF_BaseMeshCache::Deinitialize()
+{
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+#if WITH_EDITOR
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+#endif
+
+    Clear();
+    ScratchMesh = nullptr;
+
+    Super::Deinitialize();
+}
+
+UMDF_BaseMeshCache* UMDF_BaseMeshCache::Get()
+{
+    if (CVarMDFBaseMeshCacheEnable.GetValueOnGameThread() == 0) return nullptr;
+
+    return GEngine ? GEngine->GetEngineSubsystem<UMDF_BaseMeshCache>() : nullptr;
+}
+
+UMDF_BaseMeshCache::FKey UMDF_BaseMeshCache::MakeKey(const UStaticMesh* StaticMesh, const FGeometryScriptCopyMeshFromAssetOptions& AssetOptions, const FGeometryScriptMeshReadLOD& RequestedLOD)
+{
+    FKey Key;
+    Key.Asset = FObjectKey(StaticMesh);
+    Key.LODType = (int32)RequestedLOD.LODType;
+    Key.LODIndex = RequestedLOD.LODIndex;
+    Key.OptionBits =
+        (AssetOptions.bApplyBuildSettings ? 1 : 0) |
+        (AssetOptions.bRequestTangents ? 2 : 0) |
+        (AssetOptions.bIgnoreRemoveDegenerates ? 4 : 0);
+    return Key;
+}
+
+TSharedPtr<const UE::Geometry::FDynamicMesh3> UMDF_BaseMeshCache::FindOrBuild(
+    UStaticMesh* StaticMesh,
+    const FGeometryScriptCopyMeshFromAssetOptions& AssetOptions,
+    const FGeometryScriptMeshReadLOD& RequestedLOD)
+{
+    check(IsInGameThread());
+    if (!IsValid(StaticMesh)) return nullptr;
+
+    const FKey Key = MakeKey(StaticMesh, AssetOptions, RequestedLOD);
+    if (const FEntry* Found = Entries.Find(Key))
+    {
+        if (Found->Asset.Get() == StaticMesh)
+        {
+            return Found->Mesh;
+        }
+    }
+
+    // 1. 에셋 변환 (임시 UDynamicMesh 재사용)
+    if (!ScratchMesh)
+    {
+        ScratchMesh = NewObject<UDynamicMesh>(this);
+    }
+
+    EGeometryScriptOutcomePins Outcome;
+    UGeometryScriptLibrary_StaticMeshFunctions::CopyMeshFromStaticMesh(StaticMesh, ScratchMesh, AssetOptions, RequestedLOD, Outcome);
+    if (Outcome != EGeometryScriptOutcomePins::Success)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[MDF Cache] 베이스 메쉬 변환 실패: %s"), *GetNameSafe(StaticMesh));
+        return nullptr;
+    }
+
+    // 2. 컴포넌트가 변형 영역만 다시 계산할 수 있도록 기준 법선/탄젠트를 한 번 계산
+    TSharedPtr<UE::Geometry::FDynamicMesh3> BaseMesh = MakeShared<UE::Geometry::FDynamicMesh3>();
+    ScratchMesh->EditMesh([&BaseMesh](UE::Geometry::FDynamicMesh3& EditMesh)
+    {
+        *BaseMesh = MoveTemp(EditMesh);
+        EditMesh.Clear();
+    }, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+
+    FMDFMeshAttributeUtils::RecomputeNormals(*BaseMesh);
+    FMDFMeshAttributeUtils::RecomputeTangents(*BaseMesh);
+
+    FEntry& Entry = Entries.FindOrAdd(Key);
+    Entry.Asset = StaticMesh;
+    Entry.Mesh = BaseMesh;
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF Cache] 베이스 메쉬 등록: %s (LOD %d, 버텍스: %d, 항목: %d)"),
+        *GetNameSafe(StaticMesh), RequestedLOD.LODIndex, BaseMesh->VertexCount(), Entries.Num());
+
+    return Entry.Mesh;
+}
+
+TSharedPtr<const UE::Geometry::FDynamicMesh3> UMDF_BaseMeshCache::FindOrBuildCollisionProxy(UStaticMesh* StaticMesh, int32 TargetTriangleCount)
+{
+    check(IsInGameThread());
+    if (!IsValid(StaticMesh)) return nullptr;
+
+    FGeometryScriptCopyMeshFromAssetOptions AssetOptions;
+    AssetOptions.bApplyBuildSettings = true;
+    const FGeometryScriptMeshReadLOD RequestedLOD;
+
+    FKey Key = MakeKey(StaticMesh, AssetOptions, RequestedLOD);
+    Key.ProxyTriangles = FMath::Max(0, TargetTriangleCount);
+    if (const FEntry* Found = Entries.Find(Key))
+    {
+        if (Found->Asset.Get() == StaticMesh)
+        {
+            return Found->Mesh;
+        }
+    }
+
+    // 1. 변환은 렌더용 베이스 메쉬 항목을 그대로 재사용
+    TSharedPtr<const UE::Geometry::FDynamicMesh3> BaseMesh = FindOrBuild(StaticMesh, AssetOptions, RequestedLOD);
+    if (!BaseMesh.IsValid()) return nullptr;
+
+    // 2. 충돌에 필요 없는 렌더 속성 제거 후 (자동 생성이면) 목표 삼각형 수까지 단순화
+    TSharedPtr<UE::Geometry::FDynamicMesh3> ProxyMesh = MakeShared<UE::Geometry::FDynamicMesh3>(*BaseMesh);
+    FMDFMeshAttributeUtils::StripRenderAttributes(*ProxyMesh);
+    if (Key.ProxyTriangles > 0)
+    {
+        TArray<int32> NoPinnedVertices;
+        FMDFMeshSimplifier::SimplifyToTriangleCount(*ProxyMesh, Key.ProxyTriangles, NoPinnedVertices);
+    }
+
+    FEntry& Entry = Entries.FindOrAdd(Key);
+    Entry.Asset = StaticMesh;
+    Entry.Mesh = ProxyMesh;
+
+    UE_LOG(LogTemp, Log, TEXT("[MDF Cache] 충돌 프록시 등록: %s (삼각형: %d -> %d)"),
+        *GetNameSafe(StaticMesh), BaseMesh->TriangleCount(), ProxyMesh->TriangleCount());
+
+    return Entry.Mesh;
+}
+
+void UMDF_BaseMeshCache::Invalidate(const UStaticMesh* StaticMesh)
+{
+    const FObjectKey AssetKey(StaticMesh);
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (It.Key().Asset == AssetKey)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void UMDF_BaseMeshCache::Clear()
+{
+    // 이미 메쉬를 받아간 컴포넌트는 공유 포인터로 계속 들고 있으므로 안전
+    Entries.Reset();
+}
+
+void UMDF_BaseMeshCache::HandlePostGarbageCollect()
+{
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (!It.Value().Asset.IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+#if WITH_EDITOR
+void UMDF_BaseMeshCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+    // 에디터에서 에셋이 수정/재임포트되면 다음 초기화에서 다시 변환
+    if (const UStaticMesh* StaticMesh = Cast<UStaticMesh>(Object))
+    {
+        Invalidate(StaticMesh);
+    }
+}
+#endif
@@ -0,0 +1,247 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Subsystem/MDF_DeformationSubsystem.cpp
+
+#include "Subsystem/MDF_DeformationSubsystem.h"
+#include "Components/MDF_DeformableComponent.h"
+#include "Components/DynamicMeshComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarMDFSchedulerEnable(
+    TEXT("MDF.Scheduler.Enable"),
+    1,
+    TEXT("1이면 월드 변형 스케줄러가 모든 변형 컴포넌트의 배칭/적용을 관리합니다. 0이면 컴포넌트가 즉시 처리합니다."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarMDFSchedulerFrameBudgetMs(
+    TEXT("MDF.Scheduler.FrameBudgetMs"),
+    4.0f,
+    TEXT("프레임당 메쉬 변형에 쓸 수 있는 전역 예산 (밀리초). 최우선 메쉬 하나는 예산과 무관하게 처리됩니다."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarMDFSchedulerMaxDeferFrames(
+    TEXT("MDF.Scheduler.MaxDeferFrames"),
+    30,
+    TEXT("낮은 우선순위 메쉬가 이 프레임 수 이상 밀리면 예산과 무관하게 처리합니다."),
+    ECVF_Default);
+
+UMDF_DeformationSubsystem* UMDF_DeformationSubsystem::Get(const UObject* WorldContext)
+{
+    if (CVarMDFSchedulerEnable.GetValueOnGameThread() == 0) return nullptr;
+
+    const UWorld* World = IsValid(WorldContext) ? WorldContext->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UMDF_DeformationSubsystem>() : nullptr;
+}
+
+bool UMDF_DeformationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    // 에디터 프리뷰 월드에서는 컴포넌트가 즉시 처리하도록 둡니다.
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UMDF_DeformationSubsystem::Deinitialize()
+{
+    PendingBatches.Reset();
+    PendingDeformations.Reset();
+
+    Super::Deinitialize();
+}
+
+TStatId UMDF_DeformationSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMDF_DeformationSubsystem, STATGROUP_Tickables);
+}
+
+// -----------------------------------------------------------------------------
+// [등록] 컴포넌트 → 스케줄러
+// -----------------------------------------------------------------------------
+void UMDF_DeformationSubsystem::RegisterPendingBatch(UMDF_DeformableComponent* Component, float Delay)
+{
+    if (!IsValid(Component)) return;
+
+    // 이미 예약되어 있으면 기존 시점을 유지 (타이머 중복 방지와 동일한 의미)
+    for (const FPendingBatch& Pending : PendingBatches)
+    {
+        if (Pending.Component.Get() == Component) return;
+    }
+
+    FPendingBatch& NewBatch = PendingBatches.AddDefaulted_GetRef();
+    NewBatch.Component = Component;
+    NewBatch.FlushTime = GetWorld()->GetTimeSeconds() + FMath::Max(0.0f, Delay);
+}
+
+void UMDF_DeformationSubsystem::RequestDeformation(UMDF_DeformableComponent* Component)
+{
+    if (!IsValid(Component)) return;
+
+    for (const FPendingDeformation& Pending : PendingDeformations)
+    {
+        if (Pending.Component.Get() == Component) return;
+    }
+
+    FPendingDeformation& NewEntry = PendingDeformations.AddDefaulted_GetRef();
+    NewEntry.Component = Component;
+}
+
+// -----------------------------------------------------------------------------
+// [틱] 프레임당 한 번 플러시
+// -----------------------------------------------------------------------------
+void UMDF_DeformationSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    FlushDueBatches();
+    ExecutePendingDeformations();
+}
+
+void UMDF_DeformationSubsystem::FlushDueBatches()
+{
+    if (PendingBatches.IsEmpty()) return;
+
+    const double Now = GetWorld()->GetTimeSeconds();
+
+    // 플러시 중에 새 배치가 등록될 수 있으므로 이번 프레임 대상만 떼어냅니다.
+    TArray<FPendingBatch> DueBatches;
+    for (int32 i = PendingBatches.Num() - 1; i >= 0; --i)
+    {
+        if (!PendingBatches[i].Component.IsValid())
+        {
+            PendingBatches.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        }
+        else if (PendingBatches[i].FlushTime <= Now)
+        {
+            DueBatches.Add(PendingBatches[i]);
+            PendingBatches.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        }
+    }
+
+    for (const FPendingBatch& Due : DueBatches)
+    {
+        if (UMDF_DeformableComponent* Component = Due.Component.Get())
+        {
+            Component->ProcessDeformationBatch();
+        }
+    }
+}
+
+void UMDF_DeformationSubsystem::ExecutePendingDeformations()
+{
+    // 끝났거나 사라진 항목 정리
+    PendingDeformations.RemoveAll([](const FPendingDeformation& Pending)
+    {
+        const UMDF_DeformableComponent* Component = Pending.Component.Get();
+        return !IsValid(Component) || !Component->HasPendingDeformationWork();
+    });
+
+    if (PendingDeformations.IsEmpty()) return;
+
+    TArray<FVector> ViewerLocations;
+    GatherViewerLocations(ViewerLocations);
+
+    // [최적화] 안 보이고 먼 메쉬는 이번 프레임 목록에서 빼서 대기열에 남겨 둡니다.
+    // (히트는 히스토리에 쌓여 있다가 관련될 때 한 배치로 적용, 예산/기아 카운트에도 포함하지 않음)
+    TArray<FPendingDeformation> Deferred;
+    for (int32 i = PendingDeformations.Num() - 1; i >= 0; --i)
+    {
+        UMDF_DeformableComponent* Component = PendingDeformations[i].Component.Get();
+        if (!Component->IsDeformationRelevant(ViewerLocations))
+        {
+            Component->UpdateDeferredDeformation();
+            Deferred.Add(PendingDeformations[i]);
+            PendingDeformations.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        }
+    }
+
+    for (FPendingDeformation& Pending : PendingDeformations)
+    {
+        Pending.Priority = ComputePriority(Pending.Component.Get(), ViewerLocations, Pending.FramesDeferred);
+    }
+
+    PendingDeformations.Sort([](const FPendingDeformation& A, const FPendingDeformation& B)
+    {
+        return A.Priority > B.Priority;
+    });
+
+    const double BudgetSeconds = FMath::Max(0.0f, CVarMDFSchedulerFrameBudgetMs.GetValueOnGameThread()) * 0.001;
+    const int32 MaxDeferFrames = CVarMDFSchedulerMaxDeferFrames.GetValueOnGameThread();
+    const double StartTime = FPlatformTime::Seconds();
+
+    // 처리 도중 새 요청이 들어와도 이번 프레임 목록은 그대로 순회
+    TArray<FPendingDeformation> Frame = MoveTemp(PendingDeformations);
+    PendingDeformations = MoveTemp(Deferred);
+
+    for (int32 i = 0; i < Frame.Num(); ++i)
+    {
+        UMDF_DeformableComponent* Component = Frame[i].Component.Get();
+        if (!IsValid(Component)) continue;
+
+        const double Elapsed = FPlatformTime::Seconds() - StartTime;
+        const double Remaining = BudgetSeconds - Elapsed;
+        const bool bStarved = MaxDeferFrames > 0 && Frame[i].FramesDeferred >= MaxDeferFrames;
+
+        // 최우선 하나와 너무 오래 밀린 메쉬는 예산과 무관하게 처리
+        if (i == 0 || bStarved || Remaining > 0.0)
+        {
+            Component->ExecuteScheduledDeformation(FMath::Max(Remaining, 0.0));
+            Frame[i].FramesDeferred = 0;
+        }
+        else
+        {
+            Frame[i].FramesDeferred++;
+        }
+
+        // 아직 남은 작업(슬라이스 잔여, 미뤄진 메쉬)은 다음 프레임으로
+        if (Component->HasPendingDeformationWork())
+        {
+            RequestDeformation(Component);
+            if (FPendingDeformation* Carried = PendingDeformations.FindByPredicate([Component](const FPendingDeformation& P) { return P.Component.Get() == Component; }))
+            {
+                Carried->FramesDeferred = Frame[i].FramesDeferred;
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// [우선순위] 시점 거리 / 화면 크기
+// -----------------------------------------------------------------------------
+void UMDF_DeformationSubsystem::GatherViewerLocations(TArray<FVector>& OutLocations) const
+{
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+        if (!IsValid(PC) || !PC->IsLocalController()) continue;
+
+        FVector ViewLocation;
+        FRotator ViewRotation;
+        PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+        OutLocations.Add(ViewLocation);
+    }
+}
+
+float UMDF_DeformationSubsystem::ComputePriority(const UMDF_DeformableComponent* Component, const TArray<FVector>& ViewerLocations, int32 FramesDeferred) const
+{
+    // 밀린 프레임만큼 조금씩 올려서 기아(Starvation) 완화
+    const float AgeBonus = 0.05f * (float)FramesDeferred;
+
+    const UDynamicMeshComponent* MeshComp = IsValid(Component) ? Component->GetTargetMeshComponent() : nullptr;
+
+    // 데디 서버처럼 시점이 없으면 요청 순서(대기 프레임)만으로 처리
+    if (!IsValid(MeshComp) || ViewerLocations.IsEmpty()) return 1.0f + AgeBonus;
+
+    // 대리 표시/초기화 전에는 다이나믹 메쉬 바운드가 비어 있으므로 원본 메쉬 기준 바운드
+    const FBoxSphereBounds Bounds = Component->GetDeformationWorldBounds();
+
+    double MinDistSq = DBL_MAX;
+    for (const FVector& Viewer : ViewerLocations)
+    {
+        MinDistSq = FMath::Min(MinDistSq, FVector::DistSquared(Viewer, Bounds.Origin));
+    }
+
+    // 투영 크기는 반지름/거리에 비례 → 가까울수록, 클수록 먼저
+    const double Distance = FMath::Max(FMath::Sqrt(MinDistSq) - Bounds.SphereRadius, 1.0);
+    const float ScreenSize = (float)(Bounds.SphereRadius / Distance);
+
+    return ScreenSize + AgeBonus;
+}
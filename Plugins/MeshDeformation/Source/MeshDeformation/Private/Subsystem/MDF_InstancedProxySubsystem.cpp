@@ -0,0 +1,151 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Subsystem/MDF_InstancedProxySubsystem.cpp
+
+#include "Subsystem/MDF_InstancedProxySubsystem.h"
+#include "Actor/MDF_InstancedProxyActor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/MDF_DeformableComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Materials/MaterialInterface.h"
+
+UMDF_InstancedProxySubsystem* UMDF_InstancedProxySubsystem::Get(const UObject* WorldContext)
+{
+    const UWorld* World = IsValid(WorldContext) ? WorldContext->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UMDF_InstancedProxySubsystem>() : nullptr;
+}
+
+bool UMDF_InstancedProxySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UMDF_InstancedProxySubsystem::Deinitialize()
+{
+    Batches.Reset();
+    OwnerBatch.Reset();
+
+    if (AMDF_InstancedProxyActor* HostActor = Host.Get())
+    {
+        HostActor->Destroy();
+    }
+    Host.Reset();
+
+    Super::Deinitialize();
+}
+
+uint32 UMDF_InstancedProxySubsystem::MakeBatchKey(const UStaticMesh* StaticMesh, const UPrimitiveComponent* Template, ECollisionEnabled::Type CollisionEnabled)
+{
+    // 같은 에셋이라도 머티리얼/충돌 설정이 다르면 다른 배치
+    uint32 Key = GetTypeHash(StaticMesh);
+    for (int32 Index = 0; Index < Template->GetNumMaterials(); ++Index)
+    {
+        Key = HashCombine(Key, GetTypeHash(Template->GetMaterial(Index)));
+    }
+    Key = HashCombine(Key, GetTypeHash(Template->GetCollisionProfileName()));
+    Key = HashCombine(Key, ::GetTypeHash((uint8)CollisionEnabled));
+    return Key;
+}
+
+AMDF_InstancedProxyActor* UMDF_InstancedProxySubsystem::GetOrCreateHost()
+{
+    if (AMDF_InstancedProxyActor* HostActor = Host.Get())
+    {
+        return HostActor;
+    }
+
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    Params.ObjectFlags |= RF_Transient;
+
+    AMDF_InstancedProxyActor* HostActor = GetWorld()->SpawnActor<AMDF_InstancedProxyActor>(Params);
+    Host = HostActor;
+    return HostActor;
+}
+
+UInstancedStaticMeshComponent* UMDF_InstancedProxySubsystem::CreateBatchComponent(UStaticMesh* StaticMesh, const UPrimitiveComponent* Template, ECollisionEnabled::Type CollisionEnabled)
+{
+    AMDF_InstancedProxyActor* HostActor = GetOrCreateHost();
+    if (!IsValid(HostActor)) return nullptr;
+
+    UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(HostActor, NAME_None, RF_Transient);
+    ISM->SetMobility(EComponentMobility::Static);
+    ISM->SetupAttachment(HostActor->GetRootComponent());
+    ISM->SetStaticMesh(StaticMesh);
+
+    for (int32 Index = 0; Index < Template->GetNumMaterials(); ++Index)
+    {
+        ISM->SetMaterial(Index, Template->GetMaterial(Index));
+    }
+
+    // 충돌 설정 이어받기 (맞은 인스턴스는 호스트 액터의 TakeDamage에서 원래 액터로 전달)
+    ISM->SetCollisionProfileName(Template->GetCollisionProfileName());
+    ISM->SetCollisionObjectType(Template->GetCollisionObjectType());
+    ISM->SetCollisionResponseToChannels(Template->GetCollisionResponseToChannels());
+    ISM->SetCollisionEnabled(CollisionEnabled);
+    ISM->SetGenerateOverlapEvents(Template->GetGenerateOverlapEvents());
+    ISM->SetCanEverAffectNavigation(Template->CanEverAffectNavigation());
+
+    ISM->RegisterComponent();
+    HostActor->AddInstanceComponent(ISM);
+    return ISM;
+}
+
+bool UMDF_InstancedProxySubsystem::AddInstance(UMDF_DeformableComponent* Owner, UStaticMesh* StaticMesh, const FTransform& WorldTransform, const UPrimitiveComponent* Template, ECollisionEnabled::Type CollisionEnabled)
+{
+    if (!IsValid(Owner) || !IsValid(StaticMesh) || !IsValid(Template)) return false;
+    if (OwnerBatch.Contains(Owner)) return true;
+
+    const uint32 Key = MakeBatchKey(StaticMesh, Template, CollisionEnabled);
+    FBatch& Batch = Batches.FindOrAdd(Key);
+    if (!IsValid(Batch.Component))
+    {
+        Batch.Component = CreateBatchComponent(StaticMesh, Template, CollisionEnabled);
+        Batch.Owners.Reset();
+        if (!IsValid(Batch.Component)) return false;
+    }
+
+    Batch.Component->AddInstance(WorldTransform, true);
+    Batch.Owners.Add(Owner);
+    OwnerBatch.Add(Owner, Key);
+    return true;
+}
+
+void UMDF_InstancedProxySubsystem::RemoveInstance(UMDF_DeformableComponent* Owner)
+{
+    uint32 Key = 0;
+    if (!OwnerBatch.RemoveAndCopyValue(Owner, Key)) return;
+
+    FBatch* Batch = Batches.Find(Key);
+    if (!Batch) return;
+
+    // 승격은 드물게 일어나므로 선형 탐색으로 충분
+    const int32 InstanceIndex = Batch->Owners.IndexOfByKey(Owner);
+    if (InstanceIndex == INDEX_NONE) return;
+
+    Batch->Owners.RemoveAt(InstanceIndex);
+    if (IsValid(Batch->Component))
+    {
+        Batch->Component->RemoveInstance(InstanceIndex);
+
+        if (Batch->Owners.IsEmpty())
+        {
+            Batch->Component->DestroyComponent();
+            Batches.Remove(Key);
+        }
+    }
+}
+
+UMDF_DeformableComponent* UMDF_InstancedProxySubsystem::FindInstanceOwner(const UInstancedStaticMeshComponent* Component, int32 InstanceIndex) const
+{
+    if (!IsValid(Component)) return nullptr;
+
+    for (const TPair<uint32, FBatch>& Pair : Batches)
+    {
+        if (Pair.Value.Component == Component)
+        {
+            return Pair.Value.Owners.IsValidIndex(InstanceIndex) ? Pair.Value.Owners[InstanceIndex].Get() : nullptr;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,24 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Actor/MDF_InstancedProxyActor.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "MDF_InstancedProxyActor.generated.h"
+
+/**
+ * [최적화] 피해 전 변형 액터들의 인스턴스 스태틱 메쉬 호스트
+ * - UMDF_InstancedProxySubsystem이 월드마다 로컬로 하나 생성합니다. (리플리케이션 없음)
+ * - 인스턴스에 들어온 포인트/범위 데미지를 해당 인스턴스의 원래 변형 액터로 넘겨줍니다. (범위 데미지는 액터당 한 번)
+ */
+UCLASS(Transient, NotPlaceable, NotBlueprintable)
+class MESHDEFORMATION_API AMDF_InstancedProxyActor : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AMDF_InstancedProxyActor();
+
+    virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser) override;
+};
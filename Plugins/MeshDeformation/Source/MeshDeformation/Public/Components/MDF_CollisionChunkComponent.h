@@ -0,0 +1,27 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Components/MDF_CollisionChunkComponent.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/DynamicMeshComponent.h"
+#include "MDF_CollisionChunkComponent.generated.h"
+
+/**
+ * [최적화] 충돌 전용 청크 컴포넌트
+ * - UMDF_DeformableComponent가 런타임에 만들어 원본 다이나믹 메쉬 밑에 붙입니다. (상대 트랜스폼 Identity)
+ * - 렌더 상태를 만들지 않으므로 화면에는 보이지 않고, 충돌(Complex as Simple)만 담당합니다.
+ */
+UCLASS(Transient, NotBlueprintable, ClassGroup=(Custom))
+class MESHDEFORMATION_API UMDF_CollisionChunkComponent : public UDynamicMeshComponent
+{
+    GENERATED_BODY()
+
+public:
+    UMDF_CollisionChunkComponent();
+
+    virtual bool ShouldCreateRenderState() const override { return false; }
+
+    /** 이 청크가 담당하는 격자 셀 (FMDFCollisionChunkLayout::FChunk::Cell) */
+    FIntVector ChunkCell = FIntVector::ZeroValue;
+};
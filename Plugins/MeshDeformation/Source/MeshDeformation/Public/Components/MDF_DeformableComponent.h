@@ -4,10 +4,21 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Engine/HitResult.h"
+#include "Deformation/MDF_VertexSpatialHash.h"
+#include "Deformation/MDF_CollisionChunkLayout.h"
+#include "Deformation/MDF_DisplacementLayer.h"
+#include "Tasks/Task.h"
 #include "MDF_DeformableComponent.generated.h"
 
 class UDynamicMeshComponent;
+class UMDF_CollisionChunkComponent;
+class UMDF_DeformationProfile;
+class UStaticMesh;
+class UStaticMeshComponent;
 class UNiagaraSystem;
+struct FMDFKernelHit;
+struct FMDFDeformBatch;
 class USoundBase;
 
 /** * [Step 6 최적화 -> Step 7-1 네트워크 확장] 
@@ -31,16 +42,48 @@ struct FMDFHitData
     UPROPERTY()
     TSubclassOf<UDamageType> DamageTypeClass;
 
+    /**
+     * [범위 피해] 0보다 크면 폭발 히트 (LocalLocation = 폭발 중심, Damage = 충격 세기)
+     * 포인트 히트 수십 개 대신 이 기록 하나가 히스토리/리플리케이션/커널을 거칩니다. (기본값 0은 전송되지 않음)
+     */
+    UPROPERTY()
+    float OuterRadius = 0.f;
+
+    /** [범위 피해] 이 반경까지는 최대 강도 */
+    UPROPERTY()
+    float InnerRadius = 0.f;
+
+    bool IsRadial() const { return OuterRadius > 0.f; }
+
     FMDFHitData() : LocalLocation(FVector::ZeroVector), LocalDirection(FVector::ForwardVector), Damage(0.f), DamageTypeClass(nullptr) {}
     FMDFHitData(FVector Loc, FVector Dir, float Dmg, TSubclassOf<UDamageType> DmgType) 
         : LocalLocation(Loc), LocalDirection(Dir), Damage(Dmg), DamageTypeClass(DmgType) {}
 };
 
+/**
+ * [결정론] 메쉬 상태 해시 스탬프
+ * 히스토리 앞 HitCount개를 적용한 직후의 버킷 해시 (FMDFMeshStateHash)
+ */
+USTRUCT()
+struct FMDFMeshStateStamp
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 HitCount = INDEX_NONE;
+
+    UPROPERTY()
+    TArray<uint32> Buckets;
+};
+
 UCLASS(Blueprintable, ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class MESHDEFORMATION_API UMDF_DeformableComponent : public UActorComponent
 {
     GENERATED_BODY()
 
+    // [최적화] 월드 스케줄러가 배치 플러시/변형 적용을 직접 호출합니다.
+    friend class UMDF_DeformationSubsystem;
+
 public: 
     UMDF_DeformableComponent();
 
@@ -49,17 +92,31 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     /** [MeshDeformation] 포인트 데미지 수신 및 변형 데이터를 큐에 쌓음 */
     UFUNCTION()
     virtual void HandlePointDamage(AActor* DamagedActor, float Damage, class AController* InstigatedBy, FVector HitLocation, class UPrimitiveComponent* FHitComponent, FName BoneName, FVector ShotFromDirection, const class UDamageType* DamageType, AActor* DamageCauser);
 
+    /** [범위 피해] 폭발 데미지 수신 → 폭발 히트 기록 하나를 큐에 쌓음 (반경은 컴포넌트 설정값) */
+    UFUNCTION()
+    virtual void HandleRadialDamage(AActor* DamagedActor, float Damage, const class UDamageType* DamageType, FVector Origin, const FHitResult& HitInfo, class AController* InstigatedBy, AActor* DamageCauser);
+
+    /** [보안 Check] 자해 방지 + 태그(Enemy, MDF_Test) 검사 */
+    bool IsAttackerAllowed(class AController* InstigatedBy, AActor* DamageCauser) const;
+
     /** * [Step 6 최적화] 모인 타격 지점들을 한 프레임의 끝에서 한 번에 연산 
      * (서버에서만 호출되어 RPC를 발송하는 역할로 변경 예정)
      */
     void ProcessDeformationBatch();
     
-    /** [자식 클래스용] 배칭 타이머를 시작하는 헬퍼 함수 */
+    /**
+     * [최적화] MergeDistance보다 가까운 같은 데미지 타입 히트를 하나로 합칩니다.
+     * 데미지는 합산, 위치/방향은 데미지 가중 평균 (강도가 데미지에 선형이므로 반경 대비 거리가 작으면 결과가 거의 같음)
+     */
+    static void CoalesceHits(TArray<FMDFHitData>& InOutHits, double MergeDistance);
+
+    /** [자식 클래스용] 배칭을 예약하는 헬퍼 함수 (월드 스케줄러 등록, 없으면 타이머) */
     void StartBatchTimer();
 
     // -------------------------------------------------------------------------
@@ -79,6 +136,16 @@ protected:
     UFUNCTION()
     void OnRep_HitHistory();
 
+    /**
+     * [결정론] 서버 메쉬의 상태 해시 (결정론 모드에서만 갱신)
+     * 클라이언트는 같은 히트 수까지 적용한 자기 해시와 비교해서, 어긋난 버킷만 다시 계산합니다.
+     */
+    UPROPERTY(ReplicatedUsing = OnRep_AuthoritativeMeshState)
+    FMDFMeshStateStamp AuthoritativeMeshState;
+
+    UFUNCTION()
+    void OnRep_AuthoritativeMeshState();
+
     /**
      * [Step 8 변경 - 2. 이펙트 동기화 (Track A)]
      * 기존의 ApplyDeformation을 PlayEffects로 변경합니다.
@@ -97,6 +164,31 @@ public:
     UFUNCTION(BlueprintCallable, Category = "MeshDeformation")
     void InitializeDynamicMesh();
     
+    /** 변형 대상 다이나믹 메쉬 (충돌 청크 컴포넌트는 제외) */
+    UDynamicMeshComponent* GetTargetMeshComponent() const;
+
+    /**
+     * [범위 피해] 폭발 변형 요청 (서버 전용)
+     * 반경을 알고 있는 폭발 코드에서 직접 호출합니다. 안쪽 반경까지는 최대 강도, 바깥 반경까지 감쇠하며
+     * 중심에서 바깥쪽으로 한 번의 커널 패스로 밀어냅니다. (공격자 태그 검사 없음)
+     */
+    UFUNCTION(BlueprintCallable, Category = "MeshDeformation")
+    void ApplyRadialDeformation(FVector WorldOrigin, float Damage, float InnerRadius, float OuterRadius, TSubclassOf<UDamageType> DamageTypeClass);
+
+    /**
+     * [최적화] 히트 일괄 제출 (서버 전용, 산탄/파편 무기용)
+     * WorldHits는 월드 좌표(LocalLocation/LocalDirection 자리에 월드 값, 폭발 반경도 월드 단위)로 채웁니다.
+     * 펠릿마다 ApplyPointDamage → 델리게이트 → 태그 검사 → 좌표 변환을 거치는 대신,
+     * 공격자 검사와 트랜스폼 조회는 볼리당 한 번, 큐 추가와 배치 예약도 한 번만 수행합니다.
+     * 데미지 처리(체력 감소 등)는 하지 않으므로 게임 쪽 데미지는 따로 적용해야 합니다.
+     * @return 큐에 들어간 히트 수
+     */
+    int32 SubmitHits(TConstArrayView<FMDFHitData> WorldHits, class AController* InstigatedBy = nullptr, AActor* DamageCauser = nullptr);
+
+    /** [최적화] SubmitHits 블루프린트용 (같은 데미지/타입의 펠릿 묶음, 방향 배열이 비면 ShotDirection 하나를 공유) */
+    UFUNCTION(BlueprintCallable, Category = "MeshDeformation", meta = (DisplayName = "Submit Hits", AutoCreateRefTerm = "WorldDirections"))
+    int32 K2_SubmitHits(const TArray<FVector>& WorldLocations, const TArray<FVector>& WorldDirections, FVector ShotDirection, float DamagePerHit, TSubclassOf<UDamageType> DamageTypeClass, AActor* DamageCauser);
+
     /** 월드 좌표 -> 로컬 좌표 변환 */
     UFUNCTION(BlueprintCallable, Category = "MeshDeformation|수학")
     FVector ConvertWorldToLocal(FVector WorldLocation);
@@ -116,9 +208,165 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|설정", meta = (DisplayName = "변형 강도"))
     float DeformStrength = 30.0f;
 
+    /** [범위 피해] OnTakeRadialDamage로 들어온 폭발의 최대 강도 반경 (cm, 월드) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|설정", meta = (DisplayName = "폭발 변형 안쪽 반경", ClampMin = "0.0"))
+    float RadialInnerRadius = 100.0f;
+
+    /** [범위 피해] OnTakeRadialDamage로 들어온 폭발이 변형을 미치는 반경 (cm, 월드) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|설정", meta = (DisplayName = "폭발 변형 바깥 반경", ClampMin = "1.0"))
+    float RadialOuterRadius = 400.0f;
+
+    /**
+     * 변형 프로필 (감쇠 곡선 모양, 데미지 계수, 데미지 타입별 가중치)
+     * 비어 있으면 기존 동작: 선형 감쇠, 계수 0.15, 근접 1.5배 / 원거리 0.5배
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|설정", meta = (DisplayName = "변형 프로필"))
+    TObjectPtr<UMDF_DeformationProfile> DeformationProfile;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|디버그", meta = (DisplayName = "디버그 포인트 표시"))
     bool bShowDebugPoints = true;
 
+    /**
+     * [최적화] 비동기 변형
+     * 버텍스 이동/법선/탄젠트 연산을 백그라운드 작업용 메쉬에서 수행하고,
+     * 완성된 메쉬를 게임 스레드에서 한 번에 교체합니다. 작업 중 도착한 히트는 다음 작업으로 이어집니다.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "비동기 변형 (백그라운드)"))
+    bool bUseAsyncDeformation = false;
+
+    /**
+     * [최적화] 타임 슬라이싱
+     * 큰 배치(예: 중도 입장 시 수천 개의 히스토리 재생)를 여러 프레임에 나눠 처리합니다.
+     * 법선/탄젠트/충돌/렌더 갱신은 마지막 조각에서 한 번만 수행됩니다. (비동기 변형이 켜져 있으면 그쪽이 우선)
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "타임 슬라이싱 사용"))
+    bool bUseTimeSlicing = false;
+
+    /** [최적화] 타임 슬라이싱 시 프레임당 변형 예산 (밀리초) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "프레임당 예산 (ms)", ClampMin = "0.1", EditCondition = "bUseTimeSlicing"))
+    float TimeSliceBudgetMs = 2.0f;
+
+    /**
+     * [최적화] 충돌 청크 분할
+     * 충돌을 격자 단위 청크 컴포넌트로 나눠, 변형된 버텍스가 속한 청크만 비동기로 다시 쿠킹합니다.
+     * (원본 메쉬의 충돌은 꺼지고 청크가 같은 충돌 설정을 이어받습니다. 게임 월드에서만 동작)
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "충돌 청크 분할 사용"))
+    bool bUseChunkedCollision = true;
+
+    /** [최적화] 충돌 청크 한 칸의 크기 (cm, 로컬 공간) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "충돌 청크 크기 (cm)", ClampMin = "10.0", EditCondition = "bUseChunkedCollision"))
+    float CollisionChunkSize = 200.0f;
+
+    /** [최적화] 충돌 청크 컴포넌트 수 상한 (넘으면 청크 크기를 키움) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "최대 충돌 청크 수", ClampMin = "1", EditCondition = "bUseChunkedCollision"))
+    int32 MaxCollisionChunks = 64;
+
+    /**
+     * [최적화] 저해상도 충돌 프록시 메쉬 (선택, SourceStaticMesh와 같은 로컬 공간)
+     * 지정하면 충돌/트레이스는 이 메쉬로 처리하고 같은 히트로 함께 변형합니다.
+     * 데디 서버(헤드리스)는 이 메쉬만 변형하고, 클라이언트는 렌더 메쉬 + 예측용 충돌 프록시를 함께 변형합니다.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "충돌 프록시 메쉬"))
+    TObjectPtr<UStaticMesh> CollisionProxyMesh;
+
+    /** [최적화] 충돌 프록시 자동 생성: 프록시 메쉬가 없으면 원본을 이 삼각형 수까지 단순화해서 씁니다. (0이면 사용 안 함) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "충돌 프록시 자동 생성 삼각형 수", ClampMin = "0"))
+    int32 AutoCollisionProxyTriangles = 0;
+
+    /**
+     * [최적화] 안 보이는 먼 메쉬는 변형 보류 (클라이언트)
+     * 최근에 렌더링되지 않았고 모든 로컬 시점에서 보류 거리 밖이면 리플리케이션된 히트를 바로 적용하지 않고 쌓아 둡니다.
+     * 보이거나 가까워지는 순간 쌓인 히트를 한 배치로 적용합니다. (충돌 프록시가 있으면 프록시 충돌은 바로 갱신)
+     * 서버 권한 메쉬는 충돌이 게임플레이 기준이므로 충돌 프록시가 있을 때만 보류합니다.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "안 보이는 메쉬 변형 보류"))
+    bool bDeferWhenNotRelevant = false;
+
+    /** [최적화] 이 거리(cm, 바운드 표면 기준) 안에 로컬 시점이 있으면 보이지 않아도 바로 적용합니다. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "변형 보류 거리 (cm)", ClampMin = "0.0", EditCondition = "bDeferWhenNotRelevant"))
+    float DeferDistance = 5000.0f;
+
+    /** [최적화] 최근 이 시간(초) 안에 렌더링됐으면 보이는 메쉬로 봅니다. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "최근 렌더링 판정 시간 (초)", ClampMin = "0.0", EditCondition = "bDeferWhenNotRelevant"))
+    float RecentlyRenderedTolerance = 0.5f;
+
+    /**
+     * [결정론] 고정소수점 변형 커널 + 상태 해시 검증
+     * 서버와 클라이언트가 비트 단위로 같은 메쉬를 만들도록 히트를 격자에 맞추고 순서대로 정수 누적합니다.
+     * 서버는 배치마다 상태 해시를 리플리케이션하고, 클라이언트는 해시가 다를 때만 어긋난 영역을 다시 계산합니다.
+     * 충돌 프록시/국소 세분화/삼각형 예산/절단으로 토폴로지가 달라지는 메쉬는 검증하지 않습니다. (커널은 그대로 결정론)
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "결정론적 변형 (상태 해시 검증)"))
+    bool bDeterministicDeformation = false;
+
+    /**
+     * [최적화] 히트 병합
+     * 배치 안에서 가까이 붙은 히트(연사, 여러 명이 같은 곳 사격)를 하나로 합쳐 히스토리에 기록합니다.
+     * 커널 연산량, 리플리케이션 배열 크기, 저장 데이터가 함께 줄어듭니다. (이펙트는 히트마다 그대로 재생)
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "히트 병합 사용"))
+    bool bCoalesceHits = false;
+
+    /**
+     * [최적화] 피해 전 스태틱 메쉬 표시
+     * 한 번도 변형되지 않은 동안에는 다이나믹 메쉬를 비워 두고 원본 스태틱 메쉬로 렌더링/충돌을 처리합니다.
+     * 첫 변형(히트 적용)이나 절단 직전에 다이나믹 메쉬로 전환되며, 액터/컴포넌트는 그대로라 리플리케이션에는 영향이 없습니다.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "피해 전 스태틱 메쉬 사용"))
+    bool bUseStaticMeshUntilDamaged = false;
+
+    /** [최적화] 피해 전 스태틱 메쉬를 에셋별 인스턴스 메쉬로 묶어 그립니다. (끄면 액터마다 스태틱 메쉬 컴포넌트) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "인스턴스 메쉬로 묶기", EditCondition = "bUseStaticMeshUntilDamaged"))
+    bool bBatchStaticProxies = true;
+
+    /**
+     * [최적화] 국소 세분화 목표 변 길이 (cm, 0이면 사용 안 함)
+     * 타격 반경에 걸치는 삼각형을 변형 전에 이 길이까지 잘게 나눕니다.
+     * 기본 메쉬는 가볍게 두고 맞은 자리에서만 디테일이 생깁니다. (세분화된 메쉬의 수리는 스냅샷 전체 복사)
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "국소 세분화 목표 변 길이 (cm)", ClampMin = "0.0"))
+    float RefineTargetEdgeLength = 0.0f;
+
+    /** [최적화] 배치 한 번에 세분화로 추가할 수 있는 버텍스 상한 */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "배치당 세분화 버텍스 상한", ClampMin = "1", EditCondition = "RefineTargetEdgeLength > 0"))
+    int32 MaxRefineVerticesPerBatch = 4096;
+
+    /**
+     * [최적화] 삼각형 예산 (0이면 사용 안 함)
+     * 절단/세분화로 삼각형 수가 이 값을 넘으면 백그라운드에서 QEM 단순화를 돌려 평평하거나 손상되지 않은 영역부터 줄입니다.
+     * 메쉬 경계와 절단 경계(그룹/머티리얼 경계), UV/법선 이음새는 유지되고 결과는 한 번에 교체됩니다.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "삼각형 예산", ClampMin = "0"))
+    int32 TriangleBudget = 0;
+
+    /** [최적화] 단순화 목표 (예산 대비 비율). 여유를 남겨 바로 다시 단순화되지 않도록 합니다. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "단순화 목표 비율", ClampMin = "0.1", ClampMax = "1.0", EditCondition = "TriangleBudget > 0"))
+    float SimplifyTargetRatio = 0.75f;
+
+    /**
+     * [최적화] 유휴 메쉬 고정 (초, 0이면 사용 안 함)
+     * 마지막 변형 후 이 시간 동안 히트가 없으면 편집용 데이터(공간 해시, 충돌 청크, 백 버퍼)를 버리고
+     * 충돌을 단순화한 바디 하나로 합칩니다. (바디는 비동기로 쿠킹, 준비된 뒤 전환) 다음 히트에서 자동으로 풀립니다.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "유휴 후 고정 (초)", ClampMin = "0.0"))
+    float FreezeAfterIdleSeconds = 0.0f;
+
+    /** [최적화] 고정 시 렌더 전용 스태틱 메쉬로 굽고 편집용 다이나믹 메쉬까지 비웁니다. (절단된 메쉬는 제외) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "고정 시 스태틱 메쉬로 굽기", EditCondition = "FreezeAfterIdleSeconds > 0"))
+    bool bBakeFrozenMeshToStatic = true;
+
+    /**
+     * [최적화] 고정 상태의 충돌 바디 삼각형 수 (0이면 단순화 없이 메쉬 그대로)
+     * 고정 시 현재 메쉬를 이 삼각형 수까지 단순화한 충돌 전용 바디를 백그라운드에서 만들고 비동기로 쿠킹합니다.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "고정 충돌 삼각형 수", ClampMin = "0", EditCondition = "FreezeAfterIdleSeconds > 0"))
+    int32 FrozenCollisionTriangles = 2000;
+
+    /** [최적화] 병합 거리 (변형 반경 대비 비율). 작을수록 원래 모양에 가깝습니다. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|최적화", meta = (DisplayName = "병합 거리 (반경 비율)", ClampMin = "0.0", ClampMax = "1.0", EditCondition = "bCoalesceHits"))
+    float HitCoalesceRatio = 0.1f;
+
     /** [Step 6 최적화] 타격 데이터를 모으는 시간 (초) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeshDeformation|설정", meta = (DisplayName = "배칭 처리 대기 시간"))
     float BatchProcessDelay = 0.0f;
@@ -158,6 +406,27 @@ public:
     // [Step 10: 수리 시스템]
     // -------------------------------------------------------------------------
 
+    /** 메쉬 로컬 바운드 (스태틱 메쉬 대리 표시 중이면 원본 에셋 바운드) */
+    FBox GetLocalMeshBounds() const;
+
+    /**
+     * [최적화] 데디 서버 헤드리스 모드인지 (MDF.Server.Headless)
+     * 서버 사본은 위치/충돌만 유지하고 법선/탄젠트/UV 계산과 렌더 알림을 생략합니다.
+     */
+    bool IsHeadless() const;
+
+    /** 유휴 고정으로 구운 스태틱 메쉬를 표시 중인지 */
+    bool IsFrozen() const { return bFrozen; }
+
+    /** 아직 스태틱 메쉬 대리 표시 중인지 (bUseStaticMeshUntilDamaged 또는 유휴 고정) */
+    bool IsUsingStaticProxy() const { return bUsingStaticProxy; }
+
+    /**
+     * [최적화] 스태틱 메쉬 대리 표시 중이면 다이나믹 메쉬로 전환합니다. (메쉬를 수정하기 직전에 호출)
+     * 베이스 메쉬 캐시에서 복사하고 충돌을 넘겨받은 뒤 대리 표시를 제거합니다.
+     */
+    void EnsureDynamicMesh();
+
     /** [Step 10] 메쉬를 원상복구(수리)하고 히스토리를 초기화합니다. (서버 전용) */ 
     UFUNCTION(BlueprintCallable, Category = "MeshDeformation|수리", meta = (DisplayName = "메시 수리(RepairMesh)"))
     void RepairMesh();
@@ -172,6 +441,370 @@ protected:
     /** [Step 8 최적화] 클라이언트가 어디까지 변형을 적용했는지 기억하는 인덱스 */
     int32 LastAppliedIndex = 0;
 
-    /** 타이머 핸들 (중복 호출 방지용) */
+    /** 타이머 핸들 (스케줄러가 없는 월드에서만 사용, 중복 호출 방지용) */
     FTimerHandle BatchTimerHandle;
+
+    // -------------------------------------------------------------------------
+    // [최적화] 월드 스케줄러 연동 (UMDF_DeformationSubsystem)
+    // -------------------------------------------------------------------------
+
+    /** 적용할 히트가 생겼음을 스케줄러에 알립니다. (스케줄러가 없으면 즉시 적용) */
+    void ScheduleDeformation();
+
+    /** 스케줄러가 처리할 일이 남았는지 (새 히스토리 또는 슬라이스 잔여분) */
+    bool HasPendingDeformationWork() const;
+
+    /** 스케줄러 콜백: 남은 프레임 예산(초) 안에서 슬라이스를 이어가거나 새 히트를 적용합니다. */
+    void ExecuteScheduledDeformation(double BudgetSeconds);
+
+    /** HitHistory[LastAppliedIndex, Num) 구간을 메쉬에 적용 (동기/비동기/슬라이스 분기) */
+    void ApplyPendingHits(double SliceBudgetSeconds);
+
+    /**
+     * [최적화] 지금 변형을 적용할 가치가 있는지 (스케줄러가 로컬 시점 위치와 함께 매 프레임 확인)
+     * 보류 옵션이 꺼져 있거나, 진행 중인 작업이 있거나, 시점이 없으면(데디 서버) 항상 true
+     */
+    bool IsDeformationRelevant(TConstArrayView<FVector> ViewerLocations) const;
+
+    /**
+     * 스케줄러 거리/화면 크기 판정용 월드 바운드
+     * 대리 표시 중이거나 아직 메쉬를 채우지 않았으면 다이나믹 메쉬 바운드가 비었거나 오래된 값이므로 원본 스태틱 메쉬 바운드를 씁니다.
+     */
+    FBoxSphereBounds GetDeformationWorldBounds() const;
+
+    /** 보류하는 동안 호출: 충돌 프록시만 새 히트로 갱신합니다. (렌더 메쉬는 그대로) */
+    void UpdateDeferredDeformation();
+
+    /** 보류 중 로그를 한 번만 남기기 위한 플래그 */
+    bool bDeformationDeferred = false;
+
+    // -------------------------------------------------------------------------
+    // [결정론] 메쉬 상태 해시 검증
+    // -------------------------------------------------------------------------
+
+    /** 해시를 비교할 수 있는 상태인지 (결정론 모드 + 기준 자세와 토폴로지 동일 + 프록시 없음) */
+    bool CanVerifyMeshState() const;
+
+    /** 토폴로지/위치가 배치 밖에서 바뀌었을 때 호출 (다음 스탬프에서 전체 재계산) */
+    void InvalidateMeshStateHash();
+
+    /**
+     * 배치를 메쉬에 반영한 직후 호출. 버킷 해시를 갱신(Batch가 없으면 전체 계산)하고
+     * 서버는 AuthoritativeMeshState로 내보내며, 클라이언트는 자기 스탬프를 남기고 검증합니다.
+     */
+    void CommitMeshStateHash(const FMDFDeformBatch* Batch);
+
+    /** 같은 히트 수의 로컬 스탬프가 있으면 서버 해시와 비교 */
+    void VerifyMeshState();
+
+    /**
+     * 어긋난 버킷의 버텍스만 기준 자세로 되돌린 뒤 지금까지의 히스토리를 결정론 커널로 다시 적용합니다.
+     * [최적화] 히트를 기록 순서대로 하나씩, 공간 해시로 그 히트의 도달 거리 안에 있는 대상 버킷 버텍스에만 적용합니다.
+     * (결정론 커널은 버텍스마다 독립이고 중간 위치가 격자 값이라, 히트별로 나눠 적용해도 전체 재생과 결과가 같음)
+     */
+    void ResyncMeshStateBuckets(TConstArrayView<int32> Buckets);
+
+    TArray<uint32> MeshStateBuckets;
+    bool bMeshStateHashValid = false;
+
+    /** 클라이언트가 최근 배치마다 남긴 스탬프 (서버 해시가 늦게 도착해도 비교할 수 있도록) */
+    TArray<FMDFMeshStateStamp> LocalMeshStates;
+
+    /** 마지막으로 부분 재계산한 히트 수 (같은 지점에서 반복 재계산 방지) */
+    int32 LastResyncHitCount = INDEX_NONE;
+
+    // -------------------------------------------------------------------------
+    // [최적화] 공간 해시 (반경 쿼리 가속)
+    // -------------------------------------------------------------------------
+
+    /**
+     * 버텍스 공간 해시. InitializeDynamicMesh에서 한 번 만들고, 변형으로 버텍스가 움직일 때 갱신합니다.
+     * 절단 등으로 토폴로지가 바뀌면 Reset 해두면 다음 배치에서 다시 만들어집니다.
+     */
+    FMDFVertexSpatialHash VertexHash;
+
+    /** 해시가 비었거나, 셀 크기(DeformRadius)/버텍스 수가 바뀌었으면 재생성 */
+    void EnsureVertexHash(const UE::Geometry::FDynamicMesh3& Mesh);
+
+    /** HitHistory[BeginIndex, EndIndex) 구간을 커널 입력으로 변환 (데미지 타입 가중치를 여기서 미리 해석) */
+    void BuildKernelHits(int32 BeginIndex, int32 EndIndex, TArray<FMDFKernelHit>& OutHits) const;
+
+    /** 배치에서 움직인 버텍스들의 해시 셀 갱신 */
+    void ApplyBatchToVertexHash(const FMDFDeformBatch& Batch);
+
+    /** [최적화] 배치의 타격 반경 안을 목표 변 길이까지 세분화 (프론트 메쉬 직접 수정, 진행 중인 작업이 없을 때만) */
+    void RefineAroundHits(UDynamicMeshComponent* MeshComp, FMDFDeformBatch& Batch);
+
+    // -------------------------------------------------------------------------
+    // [최적화] 기준 자세 + 희소 변위 레이어 (즉시 수리)
+    // -------------------------------------------------------------------------
+
+    /**
+     * InitializeDynamicMesh 직후의 메쉬 스냅샷과 배치별 변위 기록.
+     * 토폴로지를 바꾸는 쪽(절단)은 MarkTopologyChanged를 호출하고, 손상 집합을 새 버텍스 ID로 맞춰야 합니다.
+     */
+    FMDFDisplacementLayer DisplacementLayer;
+
+    /**
+     * [최적화] 첫 변형 전까지의 공유 상태
+     * 초기화 직후에는 기준 자세(베이스 메쉬 캐시와 공유)와 렌더용 메쉬만 갖고,
+     * 공간 해시와 충돌 청크(메쉬 사본)는 첫 변형 배치나 절단에서 만듭니다.
+     */
+    bool bDeformationStateMaterialized = false;
+
+    // -------------------------------------------------------------------------
+    // [최적화] 피해 전 스태틱 메쉬 대리 표시
+    // -------------------------------------------------------------------------
+
+    bool ShouldStartAsStaticProxy() const;
+
+    /** 다이나믹 메쉬를 비우고 숨긴 뒤 스태틱 메쉬(인스턴스 또는 개별 컴포넌트)로 대신 표시합니다. */
+    void EnterStaticProxy(UDynamicMeshComponent* MeshComp);
+
+    /** 대리 표시 제거 (인스턴스 해제 / 컴포넌트 파괴) */
+    void RemoveStaticProxy();
+
+    /** 원본 메쉬 컴포넌트의 머티리얼/충돌 설정을 이어받은 개별 스태틱 메쉬 컴포넌트 */
+    UStaticMeshComponent* CreateStaticProxyComponent(UDynamicMeshComponent* MeshComp, UStaticMesh* StaticMesh, ECollisionEnabled::Type CollisionEnabled);
+
+    /** 다이나믹 메쉬를 비우고 숨깁니다. (편집용 상태도 함께 해제) */
+    void HideDynamicMesh(UDynamicMeshComponent* MeshComp, ECollisionEnabled::Type CollisionEnabled);
+
+    bool bUsingStaticProxy = false;
+
+    /** 인스턴스로 묶지 않을 때의 개별 스태틱 메쉬 컴포넌트 */
+    UPROPERTY(Transient)
+    TObjectPtr<UStaticMeshComponent> StaticProxyComponent;
+
+    /** 대리 표시 동안 꺼둔 다이나믹 메쉬의 원래 충돌 설정 */
+    TOptional<ECollisionEnabled::Type> ProxySavedCollision;
+
+    // -------------------------------------------------------------------------
+    // [최적화] 유휴 메쉬 고정 (Settle-to-Static)
+    // -------------------------------------------------------------------------
+
+    /** 변형이 반영될 때마다 다시 걸리는 유휴 타이머 */
+    void ArmFreezeTimer();
+
+    /**
+     * 타이머 콜백: 스태틱 메쉬로 굽거나(가능하면) 편집 가속 구조만 해제
+     * 충돌이 필요하면 단순화한 충돌 바디를 먼저 비동기로 쿠킹하고, 준비된 뒤에 전환합니다. (그동안 현재 충돌 유지)
+     */
+    void FreezeDeformedMesh();
+
+    /** 게임 스레드: 백그라운드에서 단순화한 메쉬로 고정용 충돌 바디 쿠킹 시작 */
+    void BeginFrozenCollision(int32 Serial, TSharedPtr<UE::Geometry::FDynamicMesh3> CollisionMesh);
+
+    /** 고정용 충돌 바디의 쿠킹이 끝났으면 충돌을 넘기고 고정 전환 (타이머) */
+    void PollFreezeTakeover();
+
+    /** 대리 표시/가속 구조 해제로 실제 전환 */
+    void CompleteFreeze(UDynamicMeshComponent* MeshComp);
+
+    /** 대기 중인 고정 전환을 버립니다. (새 변형/절단/수리) */
+    void CancelPendingFreeze();
+
+    /** 고정용 충돌 바디 제거 (편집용 메쉬가 다시 충돌을 맡은 뒤) */
+    void DestroyFrozenCollision(UDynamicMeshComponent* MeshComp);
+
+    /** 기준 자세 + 변위 레이어로 편집용 메쉬를 다시 만듭니다. (EnsureDynamicMesh에서 호출) */
+    void ThawFrozenMesh(UDynamicMeshComponent* MeshComp);
+
+    FTimerHandle FreezeTimerHandle;
+
+    bool bFrozen = false;
+
+    /** 고정 상태의 렌더 전용 메쉬 */
+    UPROPERTY(Transient)
+    TObjectPtr<UStaticMesh> FrozenStaticMesh;
+
+    /** 충돌 바디 쿠킹을 기다리는 동안의 구운 메쉬 (절단된 메쉬처럼 굽지 않으면 nullptr) */
+    UPROPERTY(Transient)
+    TObjectPtr<UStaticMesh> PendingFrozenStaticMesh;
+
+    /** 고정 상태의 단순화된 충돌 전용 바디 */
+    UPROPERTY(Transient)
+    TObjectPtr<UMDF_CollisionChunkComponent> FrozenCollisionComponent;
+
+    /** 고정용 충돌 바디가 넘겨받을 충돌 설정 */
+    ECollisionEnabled::Type PendingFreezeCollision = ECollisionEnabled::NoCollision;
+
+    bool bFreezePending = false;
+
+    /** 폐기된 고정 작업의 늦은 완료 콜백을 걸러내기 위한 일련번호 */
+    int32 FreezeSerial = 0;
+
+    FTimerHandle FreezeTakeoverTimerHandle;
+
+    /** 초기화 시: 개별 상태를 버리고 원본 메쉬 충돌로 되돌립니다. */
+    void ReleaseDeformationState(UDynamicMeshComponent* MeshComp);
+
+    /** 첫 변형 시: 충돌 청크를 만듭니다. (공간 해시는 EnsureVertexHash가 생성) */
+    void MaterializeDeformationState(UDynamicMeshComponent* MeshComp);
+
+    /**
+     * 메쉬를 기준 자세로 되돌립니다. (수리/리셋)
+     * 에셋을 다시 가져오지 않으며, 스냅샷이 없으면 false (호출자가 InitializeDynamicMesh로 대체)
+     */
+    bool RestoreRestPose();
+
+    /**
+     * [최적화] 변형 결과를 렌더 버퍼에 반영
+     * 프록시를 새로 만들지 않고(NotifyMeshUpdated X) 바뀐 삼각형의 위치/법선/탄젠트만 갱신합니다.
+     */
+    void NotifyDeformationRenderUpdate(UDynamicMeshComponent* MeshComp, const FMDFDeformBatch& Batch);
+
+    // -------------------------------------------------------------------------
+    // [최적화] 충돌 청크
+    // -------------------------------------------------------------------------
+
+    bool ShouldUseCollisionChunks() const;
+
+    /**
+     * 청크 분할을 다시 하고 충돌을 갱신합니다. (초기화/절단처럼 토폴로지가 바뀐 뒤)
+     * DirtyRegion이 주어지면 그 영역(로컬)과 겹치거나 삼각형 구성이 바뀐 청크만 다시 쿠킹합니다.
+     * 청크를 쓰지 않으면 원본 메쉬 충돌을 통째로 갱신합니다.
+     */
+    void RebuildCollisionChunks(UDynamicMeshComponent* MeshComp, const FBox* DirtyRegion = nullptr);
+
+    /** 변형 배치 후 충돌 갱신: 움직인 버텍스가 속한 청크만 위치 반영 + 비동기 재쿠킹 */
+    void UpdateCollisionForBatch(UDynamicMeshComponent* MeshComp, const FMDFDeformBatch& Batch);
+
+    UMDF_CollisionChunkComponent* CreateCollisionChunk(UDynamicMeshComponent* MeshComp, const FIntVector& Cell);
+    void DestroyCollisionChunks(UDynamicMeshComponent* MeshComp);
+
+    /**
+     * [최적화] 청크 인계 대기 확인 (타이머)
+     * 모든 청크 바디의 비동기 쿠킹이 끝났으면 청크 충돌을 켜고 원본 메쉬 충돌을 끕니다.
+     */
+    void PollCollisionTakeover();
+
+    /** 청크 컴포넌트 (CollisionChunkLayout의 청크 인덱스와 같은 순서) */
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UMDF_CollisionChunkComponent>> CollisionChunks;
+
+    FMDFCollisionChunkLayout CollisionChunkLayout;
+
+    /** 청크가 넘겨받기 전 원본 메쉬의 충돌 설정 (청크 해제 시 복원) */
+    TOptional<ECollisionEnabled::Type> SavedMeshCollisionEnabled;
+
+    /**
+     * 청크가 비동기 쿠킹 중이라 아직 원본 메쉬가 충돌을 맡고 있는지
+     * (그동안 청크 충돌은 꺼 두므로 충돌이 겹치거나 비지 않음)
+     */
+    bool bCollisionTakeoverPending = false;
+
+    FTimerHandle CollisionTakeoverTimerHandle;
+
+    // -------------------------------------------------------------------------
+    // [최적화] 저해상도 충돌 프록시
+    // -------------------------------------------------------------------------
+
+    bool HasCollisionProxy() const { return IsValid(CollisionProxyMesh) || AutoCollisionProxyTriangles > 0; }
+
+    /** 캐시에서 충돌 프록시 기준 메쉬를 가져옵니다. (렌더 속성 없음) */
+    TSharedPtr<const UE::Geometry::FDynamicMesh3> FindCollisionProxyBase() const;
+
+    /**
+     * 렌더 메쉬와 따로 두는 충돌 프록시를 기준 자세로 (다시) 만듭니다. (클라이언트/리슨 서버)
+     * 렌더 메쉬의 충돌은 꺼지고 청크도 만들지 않습니다. 헤드리스 서버는 렌더 메쉬 자리에 프록시를 쓰므로 해당 없음
+     */
+    void ResetCollisionProxy(UDynamicMeshComponent* MeshComp);
+    void DestroyCollisionProxy(UDynamicMeshComponent* MeshComp);
+
+    /**
+     * HitHistory[CollisionProxyAppliedIndex, EndIndex) 구간으로 프록시를 변형하고 다시 쿠킹합니다.
+     * 렌더 메쉬와 따로 진행하므로 렌더 변형을 보류하는 동안에도 충돌은 최신으로 유지됩니다.
+     */
+    void DeformCollisionProxy(int32 EndIndex);
+
+    /** 충돌 프록시에 어디까지 히트를 적용했는지 (프록시를 기준 자세로 만들 때 0) */
+    int32 CollisionProxyAppliedIndex = 0;
+
+    /** 렌더 메쉬와 따로 두는 충돌 프록시 (없으면 렌더 메쉬/청크가 충돌 담당) */
+    UPROPERTY(Transient)
+    TObjectPtr<UMDF_CollisionChunkComponent> CollisionProxyComponent;
+
+    mutable TWeakObjectPtr<UDynamicMeshComponent> CachedTargetMesh;
+
+    // -------------------------------------------------------------------------
+    // [최적화] 비동기 변형 (더블 버퍼)
+    // -------------------------------------------------------------------------
+
+    bool IsAsyncDeformationInFlight() const;
+
+    /** 배치를 백그라운드 태스크로 넘깁니다. (작업 중에는 프론트 메쉬 읽기 전용) */
+    void LaunchAsyncDeformation(UDynamicMeshComponent* MeshComp, TSharedPtr<FMDFDeformBatch> Batch);
+
+    /** 게임 스레드에서 백 버퍼와 프론트 메쉬를 교체합니다. */
+    void CompleteAsyncDeformation(int32 Serial, bool bLaunchNext);
+
+    /** 현재 진행 중인 배치 (없으면 nullptr) */
+    TSharedPtr<FMDFDeformBatch> AsyncDeformBatch;
+
+    /** 작업용(백 버퍼) 메쉬. 교체 후에는 이전 프론트 메쉬를 담고 있다가 다음 작업에서 재사용됩니다. */
+    TSharedPtr<UE::Geometry::FDynamicMesh3> BackBufferMesh;
+
+    UE::Tasks::FTask AsyncDeformTask;
+
+    /** 폐기/교체된 작업의 늦은 완료 콜백을 걸러내기 위한 일련번호 */
+    int32 AsyncDeformSerial = 0;
+
+    // -------------------------------------------------------------------------
+    // [최적화] 삼각형 예산 단순화 (백그라운드)
+    // -------------------------------------------------------------------------
+
+    /** 단순화 작업 중에도 프론트 메쉬는 읽기 전용입니다. (IsDeformationInProgress에 포함) */
+    bool IsSimplificationInFlight() const { return bSimplifyInFlight; }
+
+    /** 삼각형 수가 예산을 넘었으면 단순화 작업을 띄웁니다. (진행 중인 작업이 없고, 호출 직후 메쉬를 고치지 않는 곳에서만) */
+    void RequestSimplificationIfOverBudget();
+
+    /** 게임 스레드에서 단순화 결과와 프론트 메쉬를 교체합니다. */
+    void CompleteSimplification(int32 Serial, bool bLaunchNext);
+
+    UE::Tasks::FTask SimplifyTask;
+
+    /** 작업이 고정한 손상 버텍스 (작업이 끝나면 단순화된 메쉬의 ID로 바뀌어 있음) */
+    TSharedPtr<TArray<int32>> SimplifyPinnedVertices;
+    bool bSimplifyInFlight = false;
+    int32 SimplifySerial = 0;
+
+    /** 마지막 단순화 결과의 삼각형 수 (고정된 경계 때문에 예산 아래로 못 내려간 메쉬의 반복 실행 방지) */
+    int32 LastSimplifiedTriangleCount = 0;
+
+    // -------------------------------------------------------------------------
+    // [최적화] 타임 슬라이싱
+    // -------------------------------------------------------------------------
+
+    bool IsSlicedDeformationInProgress() const;
+
+    /** 남은 조각을 다음 프레임에 이어서 처리하도록 예약 (스케줄러, 없으면 타이머) */
+    void QueueSliceContinuation();
+
+    /** 타이머 콜백 (스케줄러가 없는 월드 전용): 예산만큼 처리하고 남았으면 다시 예약 */
+    void ContinueSlicedDeformation();
+
+    /** 예산(초) 안에서 후보를 조각 단위로 처리합니다. 배치가 끝나면 true */
+    bool StepSlicedDeformation(double BudgetSeconds, bool bLaunchNext);
+
+    /** 슬라이싱 중인 배치와 다음에 처리할 후보 인덱스 */
+    TSharedPtr<FMDFDeformBatch> SlicedBatch;
+    int32 SliceCursor = 0;
+    FTimerHandle SliceTimerHandle;
+
+    /** 시간 체크 단위 (후보 버텍스 수) */
+    static constexpr int32 SliceGranularity = 512;
+
+    // -------------------------------------------------------------------------
+    // [최적화] 진행 중인 작업 정리 (비동기 + 타임 슬라이싱 공통)
+    // -------------------------------------------------------------------------
+
+    bool IsDeformationInProgress() const;
+
+    /** 진행 중인 작업을 즉시 끝까지 반영합니다. (절단 등 게임 스레드에서 메쉬를 고치기 전에 호출) */
+    void FlushPendingDeformation();
+
+    /** 진행 중인 작업을 기다렸다가 결과를 버립니다. (메쉬 초기화/수리 전) */
+    void CancelPendingDeformation();
 };
\ No newline at end of file
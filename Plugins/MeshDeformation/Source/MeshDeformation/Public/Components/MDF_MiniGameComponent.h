@@ -7,6 +7,8 @@
 #include "Components/MDF_DeformableComponent.h"
 #include "MDF_MiniGameComponent.generated.h"
 
+class UDynamicMesh;
+
 /**
  * [Step 4] 약점 데이터 구조체
  * - 네트워크 복제를 위해 bIsBroken 상태를 감시함
@@ -81,6 +83,9 @@ protected:
     // [네트워크] 실제 메쉬를 깎는 "시각적 연산"만 담당 (서버/클라 공통 실행)
     void ApplyVisualMeshCut(int32 Index);
 
+    /** 절단 후 렌더 속성 갱신 (절단면 주변 법선, 박스 투영 UV, 탄젠트). 헤드리스 서버에서는 호출하지 않음 */
+    void ApplyCutRenderAttributes(UDynamicMesh* TargetMesh, const FBox& RegionBox);
+
     // [네트워크] 서버에서 데이터가 넘어왔을 때 클라이언트에서 실행될 함수
     UFUNCTION()
     void OnRep_WeakSpots();
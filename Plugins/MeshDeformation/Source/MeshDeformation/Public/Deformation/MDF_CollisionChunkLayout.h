@@ -0,0 +1,69 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_CollisionChunkLayout.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UE::Geometry { class FDynamicMesh3; }
+
+/**
+ * [최적화] 충돌 청크 분할 정보
+ * - 삼각형을 무게중심 기준으로 ChunkSize 격자 셀에 나눠 담고, 셀마다 별도 충돌 메쉬(청크)를 만듭니다.
+ * - 변형 배치에서 움직인 버텍스가 속한 청크만 다시 쿠킹하면 되므로, 쿠킹 비용이 메쉬 전체가 아니라
+ *   "건드린 영역"에 비례하게 됩니다.
+ * - 청크 메쉬는 위치/삼각형만 가지며(속성 없음), 원본 버텍스 ID → 청크 버텍스 ID 매핑을 보관합니다.
+ */
+class MESHDEFORMATION_API FMDFCollisionChunkLayout
+{
+public:
+    struct FChunk
+    {
+        /** 격자 셀 좌표 (재구성 시 기존 청크 컴포넌트와 짝을 맞추는 키) */
+        FIntVector Cell = FIntVector::ZeroValue;
+
+        /** 청크 삼각형들의 로컬 AABB */
+        FBox Bounds = FBox(ForceInit);
+
+        /** 원본 메쉬 삼각형 ID */
+        TArray<int32> Triangles;
+
+        /** 원본 버텍스 ID → 청크 메쉬 버텍스 ID */
+        TMap<int32, int32> VertexMap;
+    };
+
+    /** 청크 메쉬에 반영할 버텍스 위치 */
+    struct FVertexUpdate
+    {
+        int32 ChunkVertexID = INDEX_NONE;
+        FVector3d Position = FVector3d::ZeroVector;
+    };
+
+    /**
+     * 메쉬를 격자 청크로 나눕니다.
+     * 셀 수가 MaxChunks를 넘으면 셀 크기를 키워서 다시 나눕니다. (컴포넌트 수 상한)
+     */
+    void Build(const UE::Geometry::FDynamicMesh3& Mesh, double InChunkSize, int32 MaxChunks);
+
+    void Reset();
+
+    bool IsBuilt() const { return !Chunks.IsEmpty(); }
+    int32 Num() const { return Chunks.Num(); }
+    const FChunk& GetChunk(int32 ChunkIndex) const { return Chunks[ChunkIndex]; }
+
+    /** 청크 하나를 독립된 충돌용 메쉬(위치 + 삼각형)로 만듭니다. */
+    void BuildChunkMesh(const UE::Geometry::FDynamicMesh3& Mesh, int32 ChunkIndex, UE::Geometry::FDynamicMesh3& OutMesh) const;
+
+    /**
+     * 움직인 버텍스를 청크별 위치 갱신 목록으로 모읍니다. (청크 경계의 버텍스는 여러 청크에 들어감)
+     * OutUpdates의 키가 곧 다시 쿠킹해야 할 청크입니다.
+     */
+    void CollectVertexUpdates(const UE::Geometry::FDynamicMesh3& Mesh, TConstArrayView<int32> ModifiedVertices, TMap<int32, TArray<FVertexUpdate>>& OutUpdates) const;
+
+private:
+    double ChunkSize = 0.0;
+    TArray<FChunk> Chunks;
+
+    /** 원본 삼각형 ID → 청크 인덱스 (없으면 INDEX_NONE) */
+    TArray<int32> TriangleChunk;
+};
@@ -0,0 +1,150 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_DeformationKernel.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Deformation/MDF_DeformationProfile.h"
+
+namespace UE::Geometry { class FDynamicMesh3; }
+
+/**
+ * [최적화] 커널 전용 타격 데이터
+ * - FMDFHitData에서 UObject 의존(데미지 타입 클래스)을 제거하고,
+ *   히트별 최종 강도(DeformStrength * 데미지 계수 * 타입 가중치)를 배치당 한 번만 계산해 둡니다.
+ */
+struct FMDFKernelHit
+{
+    FVector3d Location = FVector3d::ZeroVector;
+    FVector3d Direction = FVector3d::UnitX();
+    double Strength = 0.0;
+
+    /**
+     * [범위 피해] 0보다 크면 폭발 히트
+     * Location이 폭발 중심이고, 방향은 버텍스마다 중심 → 버텍스 쪽으로 계산합니다. (Direction은 중심과 겹친 버텍스용)
+     * 안쪽 반경까지는 최대 강도, 바깥 반경까지 감쇠 곡선을 따릅니다.
+     */
+    double OuterRadius = 0.0;
+    double InnerRadius = 0.0;
+
+    bool IsRadial() const { return OuterRadius > 0.0; }
+
+    /** 이 히트가 버텍스를 움직일 수 있는 거리 (포인트 히트는 배치 반경) */
+    double GetReach(double BatchRadius) const { return IsRadial() ? OuterRadius : BatchRadius; }
+};
+
+/**
+ * [결정론] 고정소수점 격자
+ * - 위치/강도는 1/1024 cm, 방향은 1/16384, 감쇠 가중치는 1/65536 단위 정수로 다룹니다.
+ * - 격자 값은 double로 정확히 표현되므로 메쉬에 기록했다가 다시 읽어도 같은 정수로 돌아옵니다.
+ */
+struct FMDFFixedPoint
+{
+    static constexpr int32 PositionBits = 10;
+    static constexpr int32 DirectionBits = 14;
+    static constexpr int32 WeightBits = 16;
+
+    static int64 Quantize(double Value) { return FMath::RoundToInt64(Value * (double)(1 << PositionBits)); }
+    static double Dequantize(int64 Value) { return (double)Value * (1.0 / (double)(1 << PositionBits)); }
+
+    static int64 QuantizeDirection(double Value) { return FMath::RoundToInt64(Value * (double)(1 << DirectionBits)); }
+    static double DequantizeDirection(int64 Value) { return (double)Value * (1.0 / (double)(1 << DirectionBits)); }
+
+    /** 위치를 격자에 맞춥니다. (서버가 히트를 히스토리에 넣기 전에 사용 → 전송 정밀도와 무관하게 같은 값) */
+    static FVector3d SnapPosition(const FVector3d& Position)
+    {
+        return FVector3d(Dequantize(Quantize(Position.X)), Dequantize(Quantize(Position.Y)), Dequantize(Quantize(Position.Z)));
+    }
+
+    static FVector3d SnapDirection(const FVector3d& Direction)
+    {
+        return FVector3d(DequantizeDirection(QuantizeDirection(Direction.X)), DequantizeDirection(QuantizeDirection(Direction.Y)), DequantizeDirection(QuantizeDirection(Direction.Z)));
+    }
+};
+
+/**
+ * [최적화] 변형 배치 작업 단위 (동기/비동기 공통)
+ * - 입력: 커널 히트 + 공간 해시로 미리 모은 후보 버텍스 (게임 스레드에서 준비)
+ * - 출력: 실제로 움직인 버텍스와 이동 전/후 위치 (공간 해시 갱신용)
+ * - UObject를 참조하지 않으므로 백그라운드 태스크로 그대로 넘길 수 있습니다.
+ */
+struct FMDFDeformBatch
+{
+    TArray<FMDFKernelHit> Hits;
+    TArray<int32> Candidates;
+    double Radius = 0.0;
+    FMDFFalloffParams Falloff;
+
+    TArray<int32> ModifiedVertices;
+    TArray<FVector3d> OldPositions;
+    TArray<FVector3d> NewPositions;
+
+    /** 배치 준비 중 국소 세분화로 삼각형 구성이 바뀌었는지 (렌더 프록시/충돌 청크 재구성 필요) */
+    bool bTopologyChanged = false;
+
+    /**
+     * [결정론] 고정소수점 커널 사용 (ComputeDeterministicPositions)
+     * 히트를 순서대로 하나씩 누적하므로 결과가 배치 나누기와 무관합니다.
+     */
+    bool bDeterministic = false;
+};
+
+/**
+ * [최적화] 변형 커널
+ * - 후보 버텍스 목록을 캐시 크기 청크로 나눠 워커 스레드에서 오프셋을 계산합니다.
+ * - 메쉬는 읽기만 하며, 결과는 청크별로 겹치지 않는 출력 버퍼 구간에 기록됩니다.
+ *   실제 SetVertex 반영은 호출자가 게임 스레드에서 한 번에 수행합니다.
+ * - 기본 경로는 청크 위치를 float SoA로 모아 VectorRegister4Float로 버텍스 4개를 동시에 처리합니다.
+ *   (MDF.Deform.UseSIMD 0 이면 double 스칼라 경로, MDF.Deform.ValidateSIMD 1 이면 두 경로 비교)
+ */
+struct MESHDEFORMATION_API FMDFDeformationKernel
+{
+    /**
+     * Candidates[i]의 누적 오프셋을 OutOffsets[i]에, 반경 안에 들었는지를 OutModified[i]에 기록합니다.
+     * 후보 수가 MDF.Deform.ParallelMinVertices 이상이면 ParallelFor로 분산 처리합니다.
+     * 감쇠 모양은 여기서 한 번만 분기하고, 모양별로 인스턴스화된 커널이 실행됩니다.
+     */
+    static void ComputeOffsets(
+        const UE::Geometry::FDynamicMesh3& Mesh,
+        TConstArrayView<int32> Candidates,
+        TConstArrayView<FMDFKernelHit> Hits,
+        double Radius,
+        const FMDFFalloffParams& Falloff,
+        TArray<FVector3d>& OutOffsets,
+        TArray<uint8>& OutModified);
+
+    /**
+     * [결정론] 고정소수점 커널
+     * - 버텍스 위치와 히트를 격자 정수로 바꾼 뒤, 히트를 기록 순서대로 하나씩 적용합니다. (다음 히트는 이동된 위치 기준)
+     * - 거리 판정과 누적은 정수 연산이라 스레드 분할/청크 크기/배치 나누기와 무관하게 비트 단위로 같은 결과가 나옵니다.
+     * - 감쇠 곡선 값만 double로 계산한 뒤 1/65536 단위로 반올림합니다. 모든 곡선은 IEEE 사칙연산과 sqrt만 쓰며,
+     *   가우시안도 플랫폼 exp 대신 다항식 근사(DeterministicExp)를 씁니다.
+     * - 이 보장은 FMA 축약(FP contraction)이 꺼진 빌드에서만 성립합니다. (MSVC 기본 /fp:precise, clang/gcc는 -ffp-contract=off 필요)
+     *   축약되면 a*b+c 반올림이 플랫폼마다 달라질 수 있으며, 그 경우 상태 해시 검증이 불일치를 보고합니다.
+     * - SIMD 경로는 쓰지 않습니다. OutPositions[i]는 Candidates[i]의 최종 위치(격자 값)입니다.
+     */
+    static void ComputeDeterministicPositions(
+        const UE::Geometry::FDynamicMesh3& Mesh,
+        TConstArrayView<int32> Candidates,
+        TConstArrayView<FMDFKernelHit> Hits,
+        double Radius,
+        const FMDFFalloffParams& Falloff,
+        TArray<FVector3d>& OutPositions,
+        TArray<uint8>& OutModified);
+
+    /**
+     * [결정론] 후보 수집 여유 거리 (격자 두 칸)
+     * 원래 위치가 모든 히트의 도달 거리 밖인 버텍스는 어느 히트에도 움직이지 않으므로 히트별 도달 거리로 모으면 충분하고,
+     * 도달 거리 경계에서 위치 반올림으로 안쪽에 들어가는 버텍스만 놓치지 않도록 조금 넓힙니다.
+     */
+    static double GetDeterministicGatherPadding() { return FMDFFixedPoint::Dequantize(2); }
+
+    /** ComputeOffsets 결과를 Mesh에 SetVertex로 반영하고, 움직인 버텍스를 Batch 출력에 기록합니다. */
+    static void ApplyBatch(UE::Geometry::FDynamicMesh3& Mesh, FMDFDeformBatch& Batch);
+
+    /**
+     * 후보 [Begin, End) 구간만 처리하고 움직인 버텍스를 Batch 출력에 "추가"합니다. (타임 슬라이싱용)
+     * 각 버텍스의 오프셋은 자기 위치에만 의존하므로 구간을 나눠 처리해도 결과가 같습니다.
+     */
+    static void ApplyBatchRange(UE::Geometry::FDynamicMesh3& Mesh, FMDFDeformBatch& Batch, int32 Begin, int32 End);
+};
@@ -0,0 +1,84 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_DeformationProfile.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "MDF_DeformationProfile.generated.h"
+
+class UDamageType;
+
+/** 변형 감쇠 곡선 모양 (t = 거리 / 반경) */
+UENUM(BlueprintType)
+enum class EMDFFalloffShape : uint8
+{
+    /** 1 - t (기존 방식) */
+    Linear      UMETA(DisplayName = "선형 (Linear)"),
+
+    /** 부드러운 S자 (가장자리가 매끈하게 이어짐) */
+    Smoothstep  UMETA(DisplayName = "스무스스텝 (Smoothstep)"),
+
+    /** 가우시안 (중심이 뾰족하고 넓게 퍼짐) */
+    Gaussian    UMETA(DisplayName = "가우시안 (Gaussian)"),
+
+    /** 크레이터 (안쪽은 파이고 가장자리는 솟아오름) */
+    Crater      UMETA(DisplayName = "크레이터 (Crater)"),
+};
+
+/**
+ * [최적화] 커널 전용 감쇠 파라미터
+ * - 프로필(UObject)에서 값만 복사해 배치에 담아 두므로 백그라운드 태스크에서도 안전하게 읽을 수 있습니다.
+ */
+struct FMDFFalloffParams
+{
+    EMDFFalloffShape Shape = EMDFFalloffShape::Linear;
+    float GaussianSharpness = 3.0f;
+    float CraterInnerRatio = 0.7f;
+    float CraterRimHeight = 0.25f;
+};
+
+/**
+ * [변형 프로필] 디자이너용 데이터 에셋
+ * - 감쇠 곡선 모양과 데미지 → 강도 변환, 데미지 타입별 가중치를 한 곳에서 정의합니다.
+ * - 감쇠 모양마다 커널이 컴파일 타임에 따로 만들어지므로, 버텍스 루프 안에는 모양 분기가 없습니다.
+ */
+UCLASS(BlueprintType)
+class MESHDEFORMATION_API UMDF_DeformationProfile : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    /** 감쇠 곡선 모양 */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MeshDeformation|프로필", meta = (DisplayName = "감쇠 모양"))
+    EMDFFalloffShape FalloffShape = EMDFFalloffShape::Linear;
+
+    /** 데미지 1당 강도 계수 (최종 강도 = 변형 강도 * 데미지 * 계수 * 타입 가중치) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MeshDeformation|프로필", meta = (DisplayName = "데미지 계수", ClampMin = "0.0"))
+    float DamageToStrength = 0.15f;
+
+    /** 가우시안 날카로움 (클수록 중심에 집중) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MeshDeformation|프로필", meta = (DisplayName = "가우시안 날카로움", ClampMin = "0.1", EditCondition = "FalloffShape == EMDFFalloffShape::Gaussian"))
+    float GaussianSharpness = 3.0f;
+
+    /** 크레이터 안쪽(파이는 부분) 반경 비율 */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MeshDeformation|프로필", meta = (DisplayName = "크레이터 안쪽 비율", ClampMin = "0.05", ClampMax = "0.95", EditCondition = "FalloffShape == EMDFFalloffShape::Crater"))
+    float CraterInnerRatio = 0.7f;
+
+    /** 크레이터 가장자리가 솟아오르는 높이 (중심 깊이 대비) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MeshDeformation|프로필", meta = (DisplayName = "크레이터 테두리 높이", ClampMin = "0.0", EditCondition = "FalloffShape == EMDFFalloffShape::Crater"))
+    float CraterRimHeight = 0.25f;
+
+    /**
+     * 데미지 타입별 강도 가중치. 등록되지 않은 타입은 가장 가까운 부모 타입의 값을 쓰고, 없으면 1.0
+     * (배치마다 타입당 한 번만 해석되어 히트별 강도에 곱해집니다.)
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MeshDeformation|프로필", meta = (DisplayName = "데미지 타입 가중치"))
+    TMap<TSubclassOf<UDamageType>, float> DamageTypeMultipliers;
+
+    /** 클래스 계층을 따라 올라가며 가중치를 찾습니다. */
+    float ResolveDamageTypeMultiplier(const UClass* DamageTypeClass) const;
+
+    /** 커널에 넘길 감쇠 파라미터 (값 복사 + 범위 보정) */
+    FMDFFalloffParams MakeFalloffParams() const;
+};
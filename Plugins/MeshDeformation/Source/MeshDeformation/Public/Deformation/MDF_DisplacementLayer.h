@@ -0,0 +1,102 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_DisplacementLayer.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UE::Geometry { class FDynamicMesh3; }
+struct FMDFDeformBatch;
+
+/**
+ * [최적화] 기준 자세(Rest Pose) + 희소 변위 레이어
+ * - 초기화 직후의 메쉬(위치 + 법선/탄젠트/UV)를 변경 불가 스냅샷으로 한 번만 보관합니다.
+ * - 변형은 "움직인 버텍스 → 기준 위치 대비 변위"만 희소하게 기록합니다.
+ * - 수리는 에셋을 다시 가져오거나 법선/탄젠트를 다시 계산하지 않고,
+ *   변위가 있는 버텍스와 그 주변 속성만 스냅샷 값으로 되돌립니다.
+ * - 절단처럼 토폴로지가 바뀌면 희소 복원이 불가능하므로 스냅샷을 통째로 복사합니다.
+ * - 손상 버텍스 집합은 변위와 달리 토폴로지가 바뀌어도 유지됩니다. (단순화 시 찌그러진 자리 고정용)
+ */
+class MESHDEFORMATION_API FMDFDisplacementLayer
+{
+public:
+    /** 현재 메쉬를 기준 자세로 저장하고 변위를 비웁니다. (초기화 직후 한 번) */
+    void CaptureRestPose(const UE::Geometry::FDynamicMesh3& Mesh);
+
+    /** 이미 변경 불가로 공유되는 메쉬(베이스 메쉬 캐시)를 복사 없이 기준 자세로 사용합니다. */
+    void CaptureRestPose(TSharedPtr<const UE::Geometry::FDynamicMesh3> SharedMesh);
+
+    /** 스냅샷과 변위를 모두 버립니다. */
+    void Reset();
+
+    bool HasRestPose() const { return RestMesh.IsValid(); }
+
+    /** 메쉬 토폴로지가 스냅샷과 같아서 변위만 되돌리면 되는지 */
+    bool CanRestoreSparse() const { return HasRestPose() && bTopologyMatchesRest; }
+
+    /** 절단 등으로 토폴로지가 바뀌었음을 알립니다. (다음 복원은 전체 복사, 손상 집합은 유지) */
+    void MarkTopologyChanged();
+
+    /** 배치에서 움직인 버텍스의 변위를 갱신합니다. (게임 스레드, 메쉬 반영 직후) */
+    void RecordBatch(const FMDFDeformBatch& Batch);
+
+    int32 NumDisplaced() const { return DisplacedVertices.Num(); }
+
+    /** 변위가 기록된 버텍스 ID */
+    TConstArrayView<int32> GetDisplacedVertices() const { return DisplacedVertices; }
+
+    /**
+     * 손상 버텍스 ID (변형으로 움직였거나 세분화/절단으로 생긴 버텍스)
+     * 복원하면 비워지고, 토폴로지가 바뀌면 호출자가 새 ID로 맞춰 줍니다.
+     */
+    const TSet<int32>& GetDamagedVertices() const { return DamagedVertices; }
+
+    /** 세분화로 생긴 버텍스처럼 변위 기록 없이 손상으로만 표시할 버텍스를 추가합니다. */
+    void AddDamagedVertices(TConstArrayView<int32> VertexIDs);
+
+    /** 손상 집합을 통째로 바꿉니다. (단순화 후 압축된 ID로 다시 매핑했을 때) */
+    void SetDamagedVertices(TConstArrayView<int32> VertexIDs);
+
+    /** 절단 전: 손상 버텍스의 위치를 모읍니다. (불리언 결과는 버텍스 ID가 새로 매겨지므로 위치로 다시 찾음) */
+    void CaptureDamagedPositions(const UE::Geometry::FDynamicMesh3& Mesh, TArray<FVector3d>& OutPositions) const;
+
+    /** 절단 후: 위치가 그대로 남은 손상 버텍스와 절단 영역(Region) 안의 버텍스로 손상 집합을 다시 만듭니다. */
+    void RebuildDamagedVertices(const UE::Geometry::FDynamicMesh3& Mesh, TConstArrayView<FVector3d> DamagedPositions, const FBox& Region);
+
+    /** 기준 위치 대비 변위 (기록이 없으면 0) */
+    FVector3d GetDisplacement(int32 VertexID) const;
+
+    /** 스냅샷의 버텍스 위치 (CanRestoreSparse일 때만 유효) */
+    FVector3d GetRestPosition(int32 VertexID) const;
+
+    /**
+     * 변위가 있는 버텍스만 기준 위치로 되돌리고, 그 주변 삼각형의 법선/탄젠트 요소를 스냅샷에서 복사합니다.
+     * 되돌린 버텍스와 이동 전/후 위치는 OutBatch에 기록됩니다. (공간 해시/충돌/렌더 갱신에 그대로 사용)
+     */
+    void RestoreSparse(UE::Geometry::FDynamicMesh3& Mesh, FMDFDeformBatch& OutBatch);
+
+    /**
+     * 기준 자세 + 기록된 변위로 메쉬를 다시 만듭니다. (고정 해제 시, 변위 기록은 유지)
+     * 위치가 바뀐 버텍스는 OutDisplacedVertices에 담기며, 호출자가 그 영역의 법선/탄젠트를 다시 계산합니다.
+     */
+    void RebuildMesh(UE::Geometry::FDynamicMesh3& Mesh, TArray<int32>& OutDisplacedVertices) const;
+
+    /** 스냅샷을 통째로 복사합니다. (토폴로지가 바뀐 뒤) */
+    void RestoreFull(UE::Geometry::FDynamicMesh3& Mesh);
+
+private:
+    void ClearDisplacements();
+
+    /** 기준 자세 스냅샷 (캡처 후 변경하지 않음) */
+    TSharedPtr<const UE::Geometry::FDynamicMesh3> RestMesh;
+
+    bool bTopologyMatchesRest = false;
+
+    /** 희소 변위: 버텍스 ID → 슬롯, 슬롯별 (버텍스 ID, 변위) */
+    TArray<int32> SlotOfVertex;
+    TArray<int32> DisplacedVertices;
+    TArray<FVector3d> Displacements;
+
+    /** 손상 버텍스 (MarkTopologyChanged에도 유지) */
+    TSet<int32> DamagedVertices;
+};
@@ -0,0 +1,61 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_MeshAttributeUtils.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UE::Geometry { class FDynamicMesh3; }
+
+/**
+ * [최적화] 메쉬 속성(법선/탄젠트) 재계산 유틸리티
+ * - Geometry Script(UDynamicMesh) 대신 FDynamicMesh3를 직접 다루므로
+ *   백그라운드 스레드의 작업용 메쉬에도 그대로 쓸 수 있습니다.
+ * - 옵션은 Geometry Script 기본값(면적+각도 가중 법선, FastMikkT 탄젠트)과 같은 의미로 맞춥니다.
+ */
+struct MESHDEFORMATION_API FMDFMeshAttributeUtils
+{
+    /** 렌더용 속성(법선 오버레이)이 있는지. 헤드리스 서버 메쉬는 false */
+    static bool HasRenderAttributes(const UE::Geometry::FDynamicMesh3& Mesh);
+
+    /**
+     * [최적화] 렌더 전용 속성 제거 (데디 서버 헤드리스 모드)
+     * - UV/법선/탄젠트/컬러 오버레이와 버텍스별 법선/컬러/UV를 버립니다.
+     * - 머티리얼 ID(물리 머티리얼 매핑)와 폴리그룹(절단 경계)은 게임플레이에 쓰이므로 유지합니다.
+     * - 이후 법선/탄젠트 재계산 함수들은 모두 아무것도 하지 않습니다.
+     */
+    static void StripRenderAttributes(UE::Geometry::FDynamicMesh3& Mesh);
+
+    /** 메쉬 전체 법선 재계산 (RecomputeNormals 기본 옵션과 동일) */
+    static void RecomputeNormals(UE::Geometry::FDynamicMesh3& Mesh);
+
+    /**
+     * [최적화] 변형된 영역만 법선 재계산
+     * - ModifiedVertices의 1-링 삼각형에 속한 법선 요소(Element)만 다시 계산하고 나머지 오버레이는 건드리지 않습니다.
+     * - 가중치(면적+각도)는 전체 재계산과 같으므로 경계에서 이음새가 생기지 않습니다.
+     * - 수정된 버텍스가 메쉬의 절반을 넘으면 전체 재계산이 더 싸므로 그쪽으로 넘깁니다.
+     */
+    static void RecomputeNormalsRegion(UE::Geometry::FDynamicMesh3& Mesh, TConstArrayView<int32> ModifiedVertices);
+
+    /** Vertices에 인접한 삼각형(1-링)을 중복 없이 모읍니다. */
+    static void CollectOneRingTriangles(const UE::Geometry::FDynamicMesh3& Mesh, TConstArrayView<int32> Vertices, TArray<int32>& OutTriangles);
+
+    /**
+     * 버텍스 이동으로 꼭짓점 속성(법선/탄젠트)이 바뀌는 범위를 모읍니다.
+     * - OutVertexMask: 수정된 버텍스의 1-링 삼각형에 속한 버텍스
+     * - OutTriangles: 그 버텍스들을 꼭짓점으로 갖는 모든 삼각형 (렌더 버퍼에서 다시 올려야 하는 삼각형과 동일)
+     */
+    static void CollectAttributeRegion(const UE::Geometry::FDynamicMesh3& Mesh, TConstArrayView<int32> ModifiedVertices, TBitArray<>& OutVertexMask, TArray<int32>& OutTriangles);
+
+    /** 메쉬 전체 탄젠트 재계산 (ComputeTangents FastMikkT와 동일, FMeshTangentsf::ComputeTriVertexTangents) */
+    static void RecomputeTangents(UE::Geometry::FDynamicMesh3& Mesh);
+
+    /**
+     * [최적화] 변형된 영역만 탄젠트 재계산
+     * - 면 탄젠트가 바뀌는 1-링 삼각형의 버텍스(법선이 바뀐 버텍스와 동일)와, 그 평균에 참여하는 한 링 바깥 삼각형까지만 떼어내
+     *   전체 재계산과 같은 엔진 루틴(ComputeTriVertexTangents)을 돌리고, 대상 버텍스의 꼭짓점 값만 되돌려 씁니다.
+     * - 대상 버텍스는 인접 삼각형이 모두 포함되므로 전체 재계산과 같은 값이 나오고, 경계에 이음새가 생기지 않습니다.
+     * - 탄젠트 오버레이가 없거나 수정 비율이 크면 전체 재계산으로 넘깁니다.
+     */
+    static void RecomputeTangentsRegion(UE::Geometry::FDynamicMesh3& Mesh, TConstArrayView<int32> ModifiedVertices);
+};
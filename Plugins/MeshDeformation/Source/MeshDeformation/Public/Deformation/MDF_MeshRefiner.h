@@ -0,0 +1,35 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_MeshRefiner.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UE::Geometry { class FDynamicMesh3; }
+struct FMDFKernelHit;
+
+/**
+ * [최적화] 타격 지점 국소 세분화 (Adaptive Local Refinement)
+ * - 타격 반경에 걸치는 변 중 목표 길이보다 긴 변을 긴 것부터 반으로 나눕니다. (Longest-Edge Bisection)
+ * - 기본 메쉬는 가볍게 두고, 맞은 자리에서만 변형에 필요한 해상도를 만들어 줍니다.
+ * - UV/법선/탄젠트 오버레이는 FDynamicMesh3::SplitEdge가 보간하므로 이음새가 유지됩니다.
+ * - 토폴로지를 바꾸므로 게임 스레드에서 프론트 메쉬에 직접 적용합니다. (진행 중인 변형 작업이 없어야 함)
+ */
+struct MESHDEFORMATION_API FMDFMeshRefiner
+{
+    /**
+     * Hits의 Radius 구(폭발 히트는 바깥 반경 구)와 겹치는 변을 TargetEdgeLength 이하가 될 때까지 나눕니다.
+     * 검사는 SeedVertices에 붙은 변에서 시작합니다. (메쉬 전체 변을 훑지 않도록, 호출자가 공간 해시로
+     * "도달 거리 + 최대 변 길이" 안의 버텍스를 모아 넘김 - 구를 가로지르는 변은 끝점 하나가 반드시 그 안에 있음)
+     * 새로 생긴 버텍스는 OutNewVertices에 추가되며, MaxNewVertices에 도달하면 멈춥니다.
+     * 반환값: 새로 만든 버텍스 수
+     */
+    static int32 RefineAroundHits(
+        UE::Geometry::FDynamicMesh3& Mesh,
+        TConstArrayView<FMDFKernelHit> Hits,
+        TConstArrayView<int32> SeedVertices,
+        double Radius,
+        double TargetEdgeLength,
+        int32 MaxNewVertices,
+        TArray<int32>& OutNewVertices);
+};
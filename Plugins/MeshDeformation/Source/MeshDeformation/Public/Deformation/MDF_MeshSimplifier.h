@@ -0,0 +1,25 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_MeshSimplifier.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UE::Geometry { class FDynamicMesh3; }
+
+/**
+ * [최적화] 삼각형 예산 단순화 (QEM)
+ * - 절단/세분화로 불어난 메쉬를 목표 삼각형 수까지 줄입니다.
+ * - 이차 오차(Quadric Error)가 작은 변, 즉 평평하거나 손상되지 않은 영역부터 붕괴되므로 찌그러진 형상은 남습니다.
+ * - 열린 경계, 폴리그룹/머티리얼 경계(불리언 절단면), UV/법선 이음새는 고정합니다.
+ * - UObject를 참조하지 않으므로 백그라운드 태스크에서 작업용 메쉬에 그대로 쓸 수 있습니다.
+ */
+struct MESHDEFORMATION_API FMDFMeshSimplifier
+{
+    /**
+     * Mesh를 TargetTriangleCount까지 단순화한 뒤 ID를 압축하고 법선/탄젠트를 다시 계산합니다.
+     * InOutPinnedVertices는 삭제/이동하지 않으며, 압축 후의 버텍스 ID로 바꿔 돌려줍니다. (손상 버텍스 등)
+     * 반환값: 단순화 후 삼각형 수 (고정된 경계 때문에 목표보다 클 수 있음)
+     */
+    static int32 SimplifyToTriangleCount(UE::Geometry::FDynamicMesh3& Mesh, int32 TargetTriangleCount, TArray<int32>& InOutPinnedVertices);
+};
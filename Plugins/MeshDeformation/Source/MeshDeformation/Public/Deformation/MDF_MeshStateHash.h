@@ -0,0 +1,34 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_MeshStateHash.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UE::Geometry { class FDynamicMesh3; }
+struct FMDFDeformBatch;
+
+/**
+ * [결정론] 메쉬 상태 해시
+ * - 버텍스마다 (ID, 격자 위치)를 해시해서 버킷별로 더합니다. 덧셈이라 순서와 무관하고,
+ *   배치가 움직인 버텍스만 빼고 다시 더하면 되므로 전체 순회 없이 갱신됩니다.
+ * - 버텍스 ID 256개 단위 블록을 버킷 64개에 돌려 담으므로, 어긋난 버킷만 골라 다시 계산할 수 있습니다.
+ */
+struct MESHDEFORMATION_API FMDFMeshStateHash
+{
+    static constexpr int32 NumBuckets = 64;
+
+    static int32 BucketOf(int32 VertexID) { return (VertexID >> 8) & (NumBuckets - 1); }
+
+    /** 버텍스 하나의 기여분 (위치는 고정소수점 격자로 양자화) */
+    static uint32 HashVertex(int32 VertexID, const FVector3d& Position);
+
+    /** 메쉬 전체를 순회해서 버킷 해시를 새로 만듭니다. */
+    static void Compute(const UE::Geometry::FDynamicMesh3& Mesh, TArray<uint32>& OutBuckets);
+
+    /** 배치에서 움직인 버텍스의 이전 기여분을 빼고 새 기여분을 더합니다. */
+    static void ApplyBatch(const FMDFDeformBatch& Batch, TArray<uint32>& InOutBuckets);
+
+    /** 버킷을 하나로 합친 값 (로그용) */
+    static uint32 Combine(TConstArrayView<uint32> Buckets);
+};
@@ -0,0 +1,25 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_StaticMeshBaker.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UE::Geometry { class FDynamicMesh3; }
+class UStaticMesh;
+class UPrimitiveComponent;
+
+/**
+ * [최적화] 다이나믹 메쉬 → 런타임 스태틱 메쉬 굽기
+ * - 편집이 끝난(고정된) 메쉬를 렌더 전용 스태틱 메쉬로 바꿔, 편집용 토폴로지/오버레이 메모리를 버릴 수 있게 합니다.
+ * - 충돌 바디는 만들지 않습니다. (렌더 해상도 그대로 동기 쿠킹하지 않도록, 호출자가 단순화한 충돌 전용 바디를 비동기로 쿠킹)
+ * - 게임 스레드 전용 (UObject 생성)
+ */
+struct MESHDEFORMATION_API FMDFStaticMeshBaker
+{
+    /**
+     * Mesh를 Outer 소유의 임시 스태틱 메쉬로 굽습니다. 머티리얼 슬롯은 MaterialSource에서 가져옵니다.
+     * 실패하면 nullptr
+     */
+    static UStaticMesh* Bake(UObject* Outer, const UE::Geometry::FDynamicMesh3& Mesh, const UPrimitiveComponent* MaterialSource);
+};
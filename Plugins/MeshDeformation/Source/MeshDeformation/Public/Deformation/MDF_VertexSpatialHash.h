@@ -0,0 +1,61 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Deformation/MDF_VertexSpatialHash.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UE::Geometry { class FDynamicMesh3; }
+
+/**
+ * [최적화] 버텍스 균일 공간 해시 (Uniform Spatial Hash)
+ * - 메쉬의 버텍스 ID를 CellSize 크기의 격자 셀에 나눠 담아 둡니다.
+ * - 타격 지점 반경 안에 걸치는 셀만 방문하므로, 배치 비용이 메쉬 전체가 아니라
+ *   "영향받는 버텍스 수"에 비례하게 됩니다.
+ * - 버텍스가 움직이면 UpdateVertex로 셀을 옮겨줘야 합니다.
+ */
+class MESHDEFORMATION_API FMDFVertexSpatialHash
+{
+public:
+    /** 메쉬의 모든 버텍스로 해시를 새로 만듭니다. */
+    void Build(const UE::Geometry::FDynamicMesh3& Mesh, double InCellSize);
+
+    /** 해시를 비웁니다. (토폴로지가 바뀌었을 때 다음 배치에서 재생성되도록) */
+    void Reset();
+
+    bool IsBuilt() const { return CellSize > 0.0; }
+    double GetCellSize() const { return CellSize; }
+    int32 GetNumVertices() const { return NumVertices; }
+
+    /**
+     * 메쉬에서 가장 긴 변의 길이 상한. (Build 시 측정, 이후에는 늘어나는 쪽만 반영)
+     * 변이 구를 가로지르면 두 끝점 중 하나는 "반경 + 변 길이" 안에 있으므로, 세분화 시드 수집 반경의 여유로 씁니다.
+     */
+    double GetMaxEdgeLength() const { return MaxEdgeLength; }
+
+    /** 움직인 버텍스에 붙은 변만 다시 재서 최대 변 길이를 늘립니다. (세분화는 변을 줄이기만 하므로 호출 불필요) */
+    void NoteMovedVertices(const UE::Geometry::FDynamicMesh3& Mesh, TConstArrayView<int32> VertexIDs);
+
+    void InsertVertex(int32 VertexID, const FVector3d& Position);
+    void RemoveVertex(int32 VertexID, const FVector3d& Position);
+
+    /** 버텍스가 이동했을 때 셀이 바뀌는 경우에만 옮겨 담습니다. */
+    void UpdateVertex(int32 VertexID, const FVector3d& OldPosition, const FVector3d& NewPosition);
+
+    /**
+     * Center 기준 Radius 구와 겹치는 셀의 버텍스를 OutVertices에 추가합니다.
+     * 버텍스는 정확히 한 셀에만 들어있으므로, VisitedCells로 셀 중복만 막으면
+     * 여러 타격 지점을 연달아 조회해도 후보 버텍스가 중복되지 않습니다.
+     */
+    void GatherCandidates(const FVector3d& Center, double Radius, TSet<FIntVector>& VisitedCells, TArray<int32>& OutVertices) const;
+
+private:
+    FIntVector ToCell(const FVector3d& Position) const;
+
+    double CellSize = 0.0;
+    double InvCellSize = 0.0;
+    int32 NumVertices = 0;
+    double MaxEdgeLength = 0.0;
+
+    TMap<FIntVector, TArray<int32>> Cells;
+};
@@ -0,0 +1,103 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Subsystem/MDF_BaseMeshCache.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "GeometryScript/MeshAssetFunctions.h"
+#include "MDF_BaseMeshCache.generated.h"
+
+class UStaticMesh;
+namespace UE::Geometry { class FDynamicMesh3; }
+
+/**
+ * [최적화] 베이스 메쉬 캐시 (프로세스 전역)
+ * - 스태틱 메쉬 → 다이나믹 메쉬 변환 결과를 (에셋, LOD, 변환 옵션) 단위로 한 번만 만들어 공유합니다.
+ * - 캐시된 메쉬는 법선/탄젠트까지 계산이 끝난 상태이며, 이후 변경하지 않습니다. (읽기 전용 공유)
+ * - 같은 벽 에셋을 수백 개 배치해도 변환은 에셋당 한 번, 컴포넌트 초기화는 메모리 복사만 남습니다.
+ * - 게임 스레드 전용입니다.
+ */
+UCLASS()
+class MESHDEFORMATION_API UMDF_BaseMeshCache : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** 엔진의 캐시 (MDF.BaseMeshCache.Enable 0 이면 nullptr) */
+    static UMDF_BaseMeshCache* Get();
+
+    /**
+     * 캐시된 베이스 메쉬를 찾고, 없으면 변환 + 법선/탄젠트 계산 후 등록합니다.
+     * 변환에 실패하면 nullptr
+     */
+    TSharedPtr<const UE::Geometry::FDynamicMesh3> FindOrBuild(
+        UStaticMesh* StaticMesh,
+        const FGeometryScriptCopyMeshFromAssetOptions& AssetOptions,
+        const FGeometryScriptMeshReadLOD& RequestedLOD);
+
+    /**
+     * [최적화] 충돌 프록시용 메쉬 (렌더 속성 없음, 위치/머티리얼 ID만)
+     * TargetTriangleCount가 0이면 에셋을 그대로(직접 만든 프록시), 양수면 그 삼각형 수까지 단순화해서 등록합니다.
+     */
+    TSharedPtr<const UE::Geometry::FDynamicMesh3> FindOrBuildCollisionProxy(UStaticMesh* StaticMesh, int32 TargetTriangleCount);
+
+    /** 해당 에셋의 항목을 모두 버립니다. (에셋이 수정/재임포트되었을 때) */
+    void Invalidate(const UStaticMesh* StaticMesh);
+
+    /** 전부 비웁니다. (MDF.BaseMeshCache.Clear) */
+    void Clear();
+
+    int32 Num() const { return Entries.Num(); }
+
+private:
+    struct FKey
+    {
+        FObjectKey Asset;
+        int32 LODType = 0;
+        int32 LODIndex = 0;
+        uint8 OptionBits = 0;
+
+        /** 충돌 프록시 항목이면 목표 삼각형 수 (0 = 에셋 그대로), 렌더용 베이스 메쉬면 INDEX_NONE */
+        int32 ProxyTriangles = INDEX_NONE;
+
+        bool operator==(const FKey& Other) const
+        {
+            return Asset == Other.Asset && LODType == Other.LODType && LODIndex == Other.LODIndex && OptionBits == Other.OptionBits && ProxyTriangles == Other.ProxyTriangles;
+        }
+
+        friend uint32 GetTypeHash(const FKey& Key)
+        {
+            const uint32 Hash = HashCombine(HashCombine(GetTypeHash(Key.Asset), ::GetTypeHash(Key.LODType)), HashCombine(::GetTypeHash(Key.LODIndex), ::GetTypeHash(Key.OptionBits)));
+            return HashCombine(Hash, ::GetTypeHash(Key.ProxyTriangles));
+        }
+    };
+
+    struct FEntry
+    {
+        TWeakObjectPtr<UStaticMesh> Asset;
+        TSharedPtr<const UE::Geometry::FDynamicMesh3> Mesh;
+    };
+
+    static FKey MakeKey(const UStaticMesh* StaticMesh, const FGeometryScriptCopyMeshFromAssetOptions& AssetOptions, const FGeometryScriptMeshReadLOD& RequestedLOD);
+
+    /** GC 이후 언로드된 에셋의 항목 정리 */
+    void HandlePostGarbageCollect();
+
+#if WITH_EDITOR
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+    FDelegateHandle PropertyChangedHandle;
+#endif
+
+    TMap<FKey, FEntry> Entries;
+
+    /** 변환용 임시 UDynamicMesh (재사용) */
+    UPROPERTY(Transient)
+    TObjectPtr<class UDynamicMesh> ScratchMesh;
+
+    FDelegateHandle PostGarbageCollectHandle;
+};
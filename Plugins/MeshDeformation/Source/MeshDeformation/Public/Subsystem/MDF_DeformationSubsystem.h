@@ -0,0 +1,70 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Subsystem/MDF_DeformationSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MDF_DeformationSubsystem.generated.h"
+
+class UMDF_DeformableComponent;
+
+/**
+ * [최적화] 월드 단위 변형 스케줄러
+ * - 모든 UMDF_DeformableComponent의 배칭(서버 큐 플러시)과 메쉬 변형 적용을 한 곳에서 관리합니다.
+ * - 매 프레임 정해진 시점(틱 가능한 오브젝트 틱)에 한 번 플러시하며,
+ *   로컬 시점과의 거리/화면 크기로 우선순위를 매겨 전역 예산(ms) 안에서만 처리합니다.
+ * - 예산을 넘긴 낮은 우선순위 메쉬는 다음 프레임으로 미루되, 너무 오래 밀리면 강제로 처리합니다.
+ * - 보류 옵션을 켠 메쉬가 안 보이고 멀리 있으면 대기열에만 남겨 두고, 관련될 때 쌓인 히트를 한 번에 적용합니다.
+ */
+UCLASS()
+class MESHDEFORMATION_API UMDF_DeformationSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** 컴포넌트가 있는 월드의 스케줄러 (게임 월드가 아니거나 MDF.Scheduler.Enable 0 이면 nullptr) */
+    static UMDF_DeformationSubsystem* Get(const UObject* WorldContext);
+
+    /** [서버] HitQueue가 쌓였을 때 호출. Delay초 뒤 첫 플러시 시점에 ProcessDeformationBatch를 실행합니다. */
+    void RegisterPendingBatch(UMDF_DeformableComponent* Component, float Delay);
+
+    /** 적용할 변형(새 히스토리/슬라이스 잔여분)이 생겼을 때 호출 */
+    void RequestDeformation(UMDF_DeformableComponent* Component);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FPendingBatch
+    {
+        TWeakObjectPtr<UMDF_DeformableComponent> Component;
+        double FlushTime = 0.0;
+    };
+
+    struct FPendingDeformation
+    {
+        TWeakObjectPtr<UMDF_DeformableComponent> Component;
+        int32 FramesDeferred = 0;
+        float Priority = 0.0f;
+    };
+
+    /** 1단계: 예약 시간이 지난 서버 배치 플러시 (히스토리 병합 + 이펙트 멀티캐스트) */
+    void FlushDueBatches();
+
+    /** 2단계: 우선순위 순으로 예산 안에서 메쉬 변형 적용 */
+    void ExecutePendingDeformations();
+
+    /** 로컬 플레이어 시점 위치 수집 (데디 서버면 비어 있음) */
+    void GatherViewerLocations(TArray<FVector>& OutLocations) const;
+
+    /** 화면 크기 근사 (바운드 반지름 / 가장 가까운 시점까지 거리) + 대기 프레임 보정 */
+    float ComputePriority(const UMDF_DeformableComponent* Component, const TArray<FVector>& ViewerLocations, int32 FramesDeferred) const;
+
+    TArray<FPendingBatch> PendingBatches;
+    TArray<FPendingDeformation> PendingDeformations;
+};
@@ -0,0 +1,69 @@
+﻿// Gihyeon's Deformation Project (Helluna)
+// File: Source/MeshDeformation/Subsystem/MDF_InstancedProxySubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MDF_InstancedProxySubsystem.generated.h"
+
+class UStaticMesh;
+class UMaterialInterface;
+class UPrimitiveComponent;
+class UInstancedStaticMeshComponent;
+class UMDF_DeformableComponent;
+class AMDF_InstancedProxyActor;
+
+/**
+ * [최적화] 피해 전 변형 액터의 인스턴스 렌더링/충돌
+ * - 아직 한 번도 변형되지 않은 벽들을 (에셋, 머티리얼, 충돌 프로필)별 인스턴스 스태틱 메쉬 하나로 묶습니다.
+ * - 드로우 콜과 메모리가 "배치된 벽 수"가 아니라 "에셋 종류 수 + 피해 입은 벽 수"에 비례하게 됩니다.
+ * - 첫 피해 시 컴포넌트가 RemoveInstance로 빠져나가 자기 다이나믹 메쉬로 전환합니다.
+ */
+UCLASS()
+class MESHDEFORMATION_API UMDF_InstancedProxySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    /** 게임 월드가 아니면 nullptr (에디터 프리뷰는 항상 다이나믹 메쉬) */
+    static UMDF_InstancedProxySubsystem* Get(const UObject* WorldContext);
+
+    /**
+     * Owner를 인스턴스로 등록합니다. 머티리얼/충돌 설정은 Template(원래 메쉬 컴포넌트)에서 가져옵니다.
+     * 이미 등록되어 있으면 아무 것도 하지 않습니다.
+     */
+    bool AddInstance(UMDF_DeformableComponent* Owner, UStaticMesh* StaticMesh, const FTransform& WorldTransform, const UPrimitiveComponent* Template, ECollisionEnabled::Type CollisionEnabled);
+
+    /** 등록 해제 (첫 피해로 다이나믹 메쉬 전환 시 / EndPlay) */
+    void RemoveInstance(UMDF_DeformableComponent* Owner);
+
+    /** 인스턴스 히트 → 원래 컴포넌트 (데미지 전달용) */
+    UMDF_DeformableComponent* FindInstanceOwner(const UInstancedStaticMeshComponent* Component, int32 InstanceIndex) const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FBatch
+    {
+        TObjectPtr<UInstancedStaticMeshComponent> Component;
+
+        /** 인스턴스 인덱스와 같은 순서 (RemoveInstance가 뒤쪽 인덱스를 당기므로 함께 RemoveAt) */
+        TArray<TWeakObjectPtr<UMDF_DeformableComponent>> Owners;
+    };
+
+    static uint32 MakeBatchKey(const UStaticMesh* StaticMesh, const UPrimitiveComponent* Template, ECollisionEnabled::Type CollisionEnabled);
+
+    AMDF_InstancedProxyActor* GetOrCreateHost();
+    UInstancedStaticMeshComponent* CreateBatchComponent(UStaticMesh* StaticMesh, const UPrimitiveComponent* Template, ECollisionEnabled::Type CollisionEnabled);
+
+    TMap<uint32, FBatch> Batches;
+
+    /** 컴포넌트 → 배치 키 */
+    TMap<TWeakObjectPtr<UMDF_DeformableComponent>, uint32> OwnerBatch;
+
+    TWeakObjectPtr<AMDF_InstancedProxyActor> Host;
+};